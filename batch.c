@@ -0,0 +1,514 @@
+/**
+ * Brainfuck Batch Runner
+ *
+ * Runs one compiled program over many program input files, spreading the runs over a pool of threads which take runs from each other once their own are done.
+ * Every thread has its own library context, and so its own program list, while the compiled program is shared by all of them.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# if ! defined ( _DEFAULT_SOURCE )
+	# define _DEFAULT_SOURCE 1																						//Needed for the POSIX thread, directory and clock functions.
+# endif
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <time.h>
+# include <dirent.h>
+# include <pthread.h>
+# include <unistd.h>
+# include <sys/stat.h>
+# include "libbf.h"
+# include "client.h"
+# include "batch.h"
+
+# define BATCH_PATH_SIZE 4096																						//The longest path of a program input or output file.
+# define BATCH_THREADS_MAXIMUM 256																					//The most threads the runs are spread over.
+# define BATCH_OUTPUT_INITIAL_SIZE 65536																			//The starting size of the buffer the output of a run is kept in, for the output stream.
+
+/**
+ * A run of the program on one program input file.
+ */
+struct batch_job {
+	char * input ;																									//The path of the program input file.
+	int status ;																									//The status the run ended with.
+	char * message ;																								//The error of the run, or NULL if it succeeded.
+	long long position ;																							//The byte of the program source the error was found at.
+	double latency ;																								//The elapsed real time of the run, from opening its files to writing its output.
+	long long input_bytes ;																							//The number of bytes of program input read by the run.
+	long long output_bytes ;																						//The number of bytes of program output written by the run.
+} ;
+
+/**
+ * A thread of the pool, along with the runs left in its queue.
+ */
+struct batch_worker {
+	pthread_t thread ;
+	int started ;																									//Whether the thread was started, or the worker is run by the calling thread.
+	pthread_mutex_t lock ;																							//Guards the queue, which other workers take runs from.
+	long long next ;																								//The first run left in the queue.
+	long long end ;																									//The run after the last one left in the queue.
+	long long steals ;																								//The number of times the worker took runs from another queue.
+	struct bf_context * context ;																					//The library context, holding the program list of the worker.
+	FILE * input ;																									//The program input file of the current run, if it is read instead of mapped.
+	FILE * output ;																									//The program output file of the current run, or NULL to keep the output for the stream.
+	uint8_t * buffer ;																								//The output of the current run, kept until it is written to the stream.
+	long long length ;
+	long long capacity ;
+} ;
+
+/**
+ * The runs and the state shared by the workers.
+ */
+struct batch_details {
+	const struct bf_program * compiled ;																			//The program every run executes.
+	struct batch_job * jobs ;
+	long long job_count ;
+	long long job_capacity ;
+	struct batch_worker * workers ;
+	int worker_count ;
+	const char * directory ;																						//The directory the program outputs are written into, or NULL to write them to the stream.
+	FILE * stream ;																									//The stream every program output is written to, marked with the index of its run.
+	pthread_mutex_t stream_lock ;																					//Guards the stream, so that the outputs of the runs are never mixed.
+} ;
+
+/**
+ * The batch variable holding the runs and the workers.
+ */
+struct batch_details batch ;
+
+/**
+ * The error recorded for a run whose own error could not be copied, which is never freed.
+ */
+char batch_memory_message [ ] = "Not enough memory to record the error of the run." ;
+
+/**
+ * The list function that adds a run for the given program input file.
+ */
+void batch_list_add ( const char * ) ;
+
+/**
+ * The manifest function that adds a run for every program input file listed in the given manifest, one to a line.
+ */
+void batch_list_manifest ( const char * ) ;
+
+/**
+ * The directory function that adds a run for every regular file in the given directory, in the order of their names.
+ */
+void batch_list_directory ( const char * ) ;
+
+/**
+ * The worker function that runs the runs of its queue, and then those it can take from the other queues.
+ */
+void * batch_worker_run ( void * ) ;
+
+/**
+ * The summary function that shows the failed runs, the throughput and the latencies.
+ */
+void batch_summary ( double ) ;
+
+/**
+ * The error function that handles an error setting up the batch with the error procedure.
+ */
+void batch_error ( int , const char * ) ;
+
+/**
+ * The clock function that reads the monotonic clock.
+ * Returns the time in seconds.
+ */
+double batch_clock ( ) {
+	struct timespec now ;
+	clock_gettime ( CLOCK_MONOTONIC , & now ) ;
+	return now . tv_sec + now . tv_nsec / 1e9 ;
+}
+
+int batch_run ( struct bf_context * context , const struct bf_program * compiled , const char * inputs , const char * output , int threads ) {
+	struct stat status ;
+	long long index ;
+	double start ;
+	int result = 0 ;
+	memset ( & batch , 0 , sizeof ( batch ) ) ;
+	batch . compiled = compiled ;
+	if ( stat ( inputs , & status ) != 0 ) {																		//Check if the list of program input files does not exist.
+		batch_error ( -3 , "Batch input list doesn't exist." ) ;
+	}
+	if ( S_ISDIR ( status . st_mode ) ) {																			//Check if the program input files are those of a directory, or those listed in a manifest.
+		batch_list_directory ( inputs ) ;
+	}
+	else {
+		batch_list_manifest ( inputs ) ;
+	}
+	if ( batch . job_count == 0 ) {
+		batch_error ( -3 , "Batch input list has no program input files." ) ;
+	}
+	batch . stream = stdout ;																						//Write the program outputs to the standard output, unless an output was given.
+	if ( ( output != NULL ) && ( output [ 0 ] != '\0' ) ) {
+		if ( ( stat ( output , & status ) == 0 ) && S_ISDIR ( status . st_mode ) ) {								//Check if the output is a directory, in which case every run writes its own file.
+			batch . directory = output ;
+			batch . stream = NULL ;
+		}
+		else if ( ( batch . stream = fopen ( output , "wb" ) ) == NULL ) {
+			batch_error ( -7 , "Batch output file could not be opened." ) ;
+		}
+	}
+	pthread_mutex_init ( & batch . stream_lock , NULL ) ;
+	if ( threads <= 0 ) {																							//Use a thread for every processor, unless a number was given.
+		threads = ( int ) sysconf ( _SC_NPROCESSORS_ONLN ) ;
+	}
+	if ( threads > BATCH_THREADS_MAXIMUM ) {
+		threads = BATCH_THREADS_MAXIMUM ;
+	}
+	if ( threads > batch . job_count ) {																			//There is no use for more threads than runs.
+		threads = ( int ) batch . job_count ;
+	}
+	if ( threads < 1 ) {
+		threads = 1 ;
+	}
+	batch . workers = ( struct batch_worker * ) calloc ( threads , sizeof ( struct batch_worker ) ) ;
+	if ( batch . workers == NULL ) {
+		batch_error ( -5 , "Not enough memory for the batch workers." ) ;
+	}
+	batch . worker_count = threads ;
+	for ( index = 0 ; index < threads ; index ++ ) {																//Give every worker its own context, and an equal share of the runs to start with.
+		struct batch_worker * worker = & batch . workers [ index ] ;
+		pthread_mutex_init ( & worker -> lock , NULL ) ;
+		worker -> next = index * batch . job_count / threads ;
+		worker -> end = ( index + 1 ) * batch . job_count / threads ;
+		worker -> context = bf_context_copy ( context ) ;
+		if ( worker -> context == NULL ) {
+			batch_error ( -5 , "Not enough memory for the batch workers." ) ;
+		}
+	}
+	start = batch_clock ( ) ;
+	for ( index = 1 ; index < threads ; index ++ ) {																//Start the threads. The runs of any thread which cannot be started are taken by the others.
+		struct batch_worker * worker = & batch . workers [ index ] ;
+		worker -> started = ( pthread_create ( & worker -> thread , NULL , batch_worker_run , worker ) == 0 ) ;
+	}
+	batch_worker_run ( & batch . workers [ 0 ] ) ;																	//Work on the calling thread as well, which also makes sure every run is done.
+	for ( index = 1 ; index < threads ; index ++ ) {
+		if ( batch . workers [ index ] . started ) {
+			pthread_join ( batch . workers [ index ] . thread , NULL ) ;
+		}
+	}
+	batch_summary ( batch_clock ( ) - start ) ;
+	for ( index = 0 ; index < batch . job_count ; index ++ ) {														//Take the status of the first failed run, and free the runs.
+		if ( ( result == 0 ) && ( batch . jobs [ index ] . status != 0 ) ) {
+			result = batch . jobs [ index ] . status ;
+		}
+		free ( batch . jobs [ index ] . input ) ;
+		if ( batch . jobs [ index ] . message != batch_memory_message ) {
+			free ( batch . jobs [ index ] . message ) ;
+		}
+	}
+	for ( index = 0 ; index < threads ; index ++ ) {
+		bf_context_destroy ( batch . workers [ index ] . context ) ;
+		free ( batch . workers [ index ] . buffer ) ;
+		pthread_mutex_destroy ( & batch . workers [ index ] . lock ) ;
+	}
+	pthread_mutex_destroy ( & batch . stream_lock ) ;
+	if ( ( batch . stream != NULL ) && ( batch . stream != stdout ) ) {
+		fclose ( batch . stream ) ;
+	}
+	free ( batch . workers ) ;
+	free ( batch . jobs ) ;
+	return result ;
+}
+
+void batch_list_add ( const char * input ) {
+	if ( batch . job_count == batch . job_capacity ) {																//Check if the list of runs is full, and double it.
+		long long capacity = ( batch . job_capacity == 0 ) ? 1024 : 2 * batch . job_capacity ;
+		struct batch_job * jobs = ( struct batch_job * ) realloc ( batch . jobs , capacity * sizeof ( struct batch_job ) ) ;
+		if ( jobs == NULL ) {
+			batch_error ( -5 , "Not enough memory for the batch input list." ) ;
+		}
+		batch . jobs = jobs ;
+		batch . job_capacity = capacity ;
+	}
+	memset ( & batch . jobs [ batch . job_count ] , 0 , sizeof ( struct batch_job ) ) ;
+	batch . jobs [ batch . job_count ] . input = strdup ( input ) ;
+	if ( batch . jobs [ batch . job_count ] . input == NULL ) {
+		batch_error ( -5 , "Not enough memory for the batch input list." ) ;
+	}
+	batch . job_count ++ ;
+}
+
+void batch_list_manifest ( const char * manifest_file ) {
+	FILE * manifest = fopen ( manifest_file , "r" ) ;
+	const char * slash = strrchr ( manifest_file , '/' ) ;
+	char line [ BATCH_PATH_SIZE ] , path [ 2 * BATCH_PATH_SIZE ] ;
+	if ( manifest == NULL ) {
+		batch_error ( -3 , "Batch input list doesn't exist." ) ;
+	}
+	while ( fgets ( line , sizeof ( line ) , manifest ) != NULL ) {													//Add a run for every line that is not empty or a comment.
+		line [ strcspn ( line , "\r\n" ) ] = '\0' ;
+		if ( ( line [ 0 ] == '\0' ) || ( line [ 0 ] == '#' ) ) {
+			continue ;
+		}
+		if ( ( line [ 0 ] == '/' ) || ( slash == NULL ) ) {															//Resolve the path relative to the directory of the manifest.
+			snprintf ( path , sizeof ( path ) , "%s" , line ) ;
+		}
+		else {
+			snprintf ( path , sizeof ( path ) , "%.*s/%s" , ( int ) ( slash - manifest_file ) , manifest_file , line ) ;
+		}
+		batch_list_add ( path ) ;
+	}
+	fclose ( manifest ) ;
+}
+
+/**
+ * The comparison function that orders runs by the path of their program input file.
+ */
+int batch_compare_input ( const void * first , const void * second ) {
+	return strcmp ( ( ( const struct batch_job * ) first ) -> input , ( ( const struct batch_job * ) second ) -> input ) ;
+}
+
+void batch_list_directory ( const char * directory_name ) {
+	DIR * directory = opendir ( directory_name ) ;
+	struct dirent * entry ;
+	char path [ 2 * BATCH_PATH_SIZE ] ;
+	if ( directory == NULL ) {
+		batch_error ( -3 , "Batch input list doesn't exist." ) ;
+	}
+	while ( ( entry = readdir ( directory ) ) != NULL ) {															//Add a run for every regular file, leaving out the hidden ones.
+		struct stat status ;
+		if ( entry -> d_name [ 0 ] == '.' ) {
+			continue ;
+		}
+		if ( ( snprintf ( path , sizeof ( path ) , "%s/%s" , directory_name , entry -> d_name ) < ( int ) sizeof ( path ) ) && ( stat ( path , & status ) == 0 ) && S_ISREG ( status . st_mode ) ) {
+			batch_list_add ( path ) ;
+		}
+	}
+	closedir ( directory ) ;
+	qsort ( batch . jobs , batch . job_count , sizeof ( struct batch_job ) , batch_compare_input ) ;				//Number the runs in the order of the file names, whatever order the directory lists them in.
+}
+
+/**
+ * The take function that takes the next run from the queue of the worker, or takes the back half of another queue once its own is empty.
+ * Returns the index of the run, or -1 if every queue is empty.
+ */
+long long batch_take ( struct batch_worker * worker ) {
+	long long job = -1 ;
+	int index ;
+	pthread_mutex_lock ( & worker -> lock ) ;
+	if ( worker -> next < worker -> end ) {
+		job = worker -> next ++ ;
+	}
+	pthread_mutex_unlock ( & worker -> lock ) ;
+	for ( index = 1 ; ( job < 0 ) && ( index < batch . worker_count ) ; index ++ ) {								//Look through the other queues, starting from the next worker, for runs to take.
+		struct batch_worker * victim = & batch . workers [ ( ( worker - batch . workers ) + index ) % batch . worker_count ] ;
+		long long start , end ;
+		pthread_mutex_lock ( & victim -> lock ) ;
+		start = victim -> next + ( victim -> end - victim -> next ) / 2 ;											//Take the back half, which is at least the last run if any are left.
+		end = victim -> end ;
+		victim -> end = start ;
+		pthread_mutex_unlock ( & victim -> lock ) ;
+		if ( start < end ) {
+			pthread_mutex_lock ( & worker -> lock ) ;																//Run the first of the taken runs now, and queue the rest.
+			worker -> next = start + 1 ;
+			worker -> end = end ;
+			pthread_mutex_unlock ( & worker -> lock ) ;
+			worker -> steals ++ ;
+			job = start ;
+		}
+	}
+	return job ;
+}
+
+/**
+ * The read function that reads the program input file of the current run of a worker.
+ * Returns the number of bytes read, or 0 at the end of the file.
+ */
+long long batch_read ( void * user , uint8_t * buffer , long long capacity ) {
+	return bf_file_read ( ( ( struct batch_worker * ) user ) -> input , buffer , capacity ) ;
+}
+
+/**
+ * The write function that writes the program output of the current run of a worker to its file, or keeps it for the stream.
+ * Returns the number of bytes written.
+ */
+long long batch_write ( void * user , const uint8_t * data , long long length ) {
+	struct batch_worker * worker = ( struct batch_worker * ) user ;
+	if ( worker -> output != NULL ) {
+		return bf_file_write ( worker -> output , data , length ) ;
+	}
+	if ( worker -> length + length > worker -> capacity ) {															//Check if the output does not fit, and grow the buffer to hold it.
+		long long capacity = ( worker -> capacity == 0 ) ? BATCH_OUTPUT_INITIAL_SIZE : worker -> capacity ;
+		uint8_t * buffer ;
+		while ( capacity < worker -> length + length ) {
+			capacity *= 2 ;
+		}
+		buffer = ( uint8_t * ) realloc ( worker -> buffer , capacity ) ;
+		if ( buffer == NULL ) {
+			return 0 ;																								//Return 0 as there is not enough memory, which fails the run.
+		}
+		worker -> buffer = buffer ;
+		worker -> capacity = capacity ;
+	}
+	memcpy ( worker -> buffer + worker -> length , data , length ) ;
+	worker -> length += length ;
+	return length ;
+}
+
+/**
+ * The failure function that records an error of a run.
+ */
+void batch_job_error ( struct batch_job * job , int status , const char * message , long long position ) {
+	job -> status = status ;
+	job -> message = strdup ( message ) ;
+	if ( job -> message == NULL ) {																					//Check if the error could not be copied, and record that instead, so the run still shows as failed.
+		job -> message = batch_memory_message ;
+	}
+	job -> position = position ;
+}
+
+/**
+ * The job function that runs the program on the program input file of a run, and writes its output.
+ */
+void batch_job_run ( struct batch_worker * worker , long long index ) {
+	struct batch_job * job = & batch . jobs [ index ] ;
+	double start = batch_clock ( ) ;
+	const uint8_t * mapping = NULL ;
+	long long mapping_length = 0 ;
+	struct bf_io io ;
+	struct bf_stats stats ;
+	int status ;
+	memset ( & io , 0 , sizeof ( io ) ) ;
+	worker -> input = fopen ( job -> input , "rb" ) ;																//Open the program input file, and map it into memory if it is a regular file.
+	if ( worker -> input == NULL ) {
+		batch_job_error ( job , -3 , "Program input file doesn't exist." , 0 ) ;
+	}
+	else {
+		mapping = bf_file_map ( worker -> input , & mapping_length ) ;
+	}
+	worker -> output = NULL ;
+	worker -> length = 0 ;
+	if ( ( batch . directory != NULL ) && ( job -> message == NULL ) ) {											//Check if the output goes to a file of its own, named after the index of the run and the program input file.
+		const char * name = strrchr ( job -> input , '/' ) ;
+		char path [ 2 * BATCH_PATH_SIZE ] ;
+		name = ( name == NULL ) ? job -> input : name + 1 ;
+		if ( snprintf ( path , sizeof ( path ) , "%s/%lld-%s.out" , batch . directory , index , name ) < ( int ) sizeof ( path ) ) {	//The index keeps the names apart when program input files in different directories share a name.
+			worker -> output = fopen ( path , "wb" ) ;
+		}
+		if ( worker -> output == NULL ) {
+			batch_job_error ( job , -7 , "Program output file could not be opened." , 0 ) ;
+		}
+	}
+	if ( job -> message == NULL ) {
+		io . input = mapping ;
+		io . input_length = mapping_length ;
+		io . read = ( mapping == NULL ) ? batch_read : NULL ;
+		io . write = batch_write ;
+		io . user = worker ;
+		status = bf_program_run ( worker -> context , batch . compiled , & io ) ;									//Run the program with the context of the worker.
+		if ( status != BF_OK ) {
+			long long position ;
+			const char * message = bf_context_error ( worker -> context , & position ) ;
+			batch_job_error ( job , status , message , position ) ;
+		}
+		bf_context_stats ( worker -> context , batch . compiled , & stats ) ;
+		job -> input_bytes = stats . input_bytes ;
+		job -> output_bytes = io . output_length ;
+	}
+	if ( worker -> input != NULL ) {
+		bf_file_unmap ( mapping , mapping_length ) ;
+		fclose ( worker -> input ) ;
+		worker -> input = NULL ;
+	}
+	if ( worker -> output != NULL ) {
+		if ( ( fclose ( worker -> output ) != 0 ) && ( job -> message == NULL ) ) {									//Check if the end of the output could not be written.
+			batch_job_error ( job , BF_ERROR_OUTPUT , "The program output could not be written." , 0 ) ;
+		}
+		worker -> output = NULL ;
+	}
+	else if ( batch . stream != NULL ) {																			//Write the output to the stream after a line giving the index of the run, the length of the output, the status and the program input file.
+		pthread_mutex_lock ( & batch . stream_lock ) ;
+		fprintf ( batch . stream , "@%lld %lld %d %s\n" , index , worker -> length , job -> status , job -> input ) ;
+		fwrite ( worker -> buffer , 1 , ( size_t ) worker -> length , batch . stream ) ;
+		fputc ( '\n' , batch . stream ) ;
+		pthread_mutex_unlock ( & batch . stream_lock ) ;
+	}
+	job -> latency = batch_clock ( ) - start ;
+}
+
+void * batch_worker_run ( void * argument ) {
+	struct batch_worker * worker = ( struct batch_worker * ) argument ;
+	long long job ;
+	while ( ( job = batch_take ( worker ) ) >= 0 ) {																//Keep running runs until every queue is empty.
+		batch_job_run ( worker , job ) ;
+	}
+	return NULL ;
+}
+
+/**
+ * The comparison function that orders latencies from the shortest to the longest.
+ */
+int batch_compare_latency ( const void * first , const void * second ) {
+	double difference = * ( const double * ) first - * ( const double * ) second ;
+	return ( difference > 0 ) - ( difference < 0 ) ;
+}
+
+/**
+ * The percentile function that finds the latency which the given percentage of the runs took no longer than.
+ * Returns the latency in milliseconds.
+ */
+double batch_percentile ( const double * latencies , long long count , double percent ) {
+	long long rank = ( long long ) ( percent * count / 100.0 + 0.999999 ) ;											//The nearest rank, counting from 1.
+	if ( rank < 1 ) {
+		rank = 1 ;
+	}
+	if ( rank > count ) {
+		rank = count ;
+	}
+	return 1000.0 * latencies [ rank - 1 ] ;
+}
+
+void batch_summary ( double wall ) {
+	double * latencies = ( double * ) malloc ( batch . job_count * sizeof ( double ) ) ;
+	long long index , failed = 0 , steals = 0 , input_bytes = 0 , output_bytes = 0 ;
+	double total = 0 ;
+	for ( index = 0 ; index < batch . job_count ; index ++ ) {														//Show the failed runs, and add up the totals of all of them.
+		struct batch_job * job = & batch . jobs [ index ] ;
+		if ( job -> status != 0 ) {
+			fprintf ( stderr , "Run %lld ( %s ) : ERROR : %s ( byte %lld )\n" , index , job -> input , job -> message , job -> position ) ;
+			failed ++ ;
+		}
+		input_bytes += job -> input_bytes ;
+		output_bytes += job -> output_bytes ;
+		total += job -> latency ;
+		if ( latencies != NULL ) {
+			latencies [ index ] = job -> latency ;
+		}
+	}
+	for ( index = 0 ; index < batch . worker_count ; index ++ ) {
+		steals += batch . workers [ index ] . steals ;
+	}
+	if ( wall <= 0 ) {
+		wall = 1e-9 ;
+	}
+	fprintf ( stderr , "\n------------------" ) ;
+	fprintf ( stderr , "\nBATCH" ) ;
+	fprintf ( stderr , "\nRuns : %lld ( %lld failed )" , batch . job_count , failed ) ;
+	fprintf ( stderr , "\nThreads : %d ( %lld steals )" , batch . worker_count , steals ) ;
+	fprintf ( stderr , "\nWall time : %f" , wall ) ;
+	fprintf ( stderr , "\nThroughput : %.1f runs/s" , batch . job_count / wall ) ;
+	fprintf ( stderr , "\nInput : %lld bytes ( %.2f MB/s )" , input_bytes , input_bytes / wall / 1e6 ) ;
+	fprintf ( stderr , "\nOutput : %lld bytes ( %.2f MB/s )" , output_bytes , output_bytes / wall / 1e6 ) ;
+	if ( latencies != NULL ) {																						//Sort the latencies to find the percentiles.
+		qsort ( latencies , batch . job_count , sizeof ( double ) , batch_compare_latency ) ;
+		fprintf ( stderr , "\nLatency ( ms ) : min %.3f , p50 %.3f , p90 %.3f , p99 %.3f , max %.3f , mean %.3f" ,
+			1000.0 * latencies [ 0 ] , batch_percentile ( latencies , batch . job_count , 50 ) , batch_percentile ( latencies , batch . job_count , 90 ) ,
+			batch_percentile ( latencies , batch . job_count , 99 ) , 1000.0 * latencies [ batch . job_count - 1 ] , 1000.0 * total / batch . job_count ) ;
+	}
+	fprintf ( stderr , "\n------------------\n\n" ) ;
+	free ( latencies ) ;
+}
+
+void batch_error ( int status , const char * message ) {
+	strcpy ( client . message , message ) ;																	//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+	client . status = status ;
+	client . position = 0 ;
+	error_procedure ( ) ;
+}
@@ -0,0 +1,13 @@
+# ifndef BRAINF_BATCH_FILE
+	# define BRAINF_BATCH_FILE 0
+
+	# include "libbf.h"
+
+	/**
+	 * The batch function that runs the compiled program once for every program input file listed in the given manifest or found in the given directory, spreading the runs over the given number of threads.
+	 * The outputs are written to their own files if the output is a directory, or otherwise to a single stream, each marked with the index of its input.
+	 * Returns 0 if every run succeeded, or the status of the first run that failed.
+	 */
+	int batch_run ( struct bf_context * , const struct bf_program * , const char * , const char * , int ) ;
+
+#endif
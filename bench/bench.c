@@ -0,0 +1,481 @@
+/**
+ * Brainfuck Benchmark Harness
+ *
+ * Runs every program of the benchmark corpus with every interpreter configuration, and reports the timings, rates, memory use and output checksums as JSON.
+ * The results can be compared against a stored baseline, so that regressions show up.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# if ! defined ( _DEFAULT_SOURCE )
+	# define _DEFAULT_SOURCE 1																						//Needed for the POSIX process and clock functions.
+# endif
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <time.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/resource.h>
+# include <sys/time.h>
+# include <sys/types.h>
+# include <sys/wait.h>
+
+# define BENCH_NAME_SIZE 256																						//The longest name, path or option list read from the command line or the corpus manifest.
+# define BENCH_ARGUMENTS_MAXIMUM 32																					//The most arguments any interpreter run is given.
+# define BENCH_CONFIGS_MAXIMUM 16																					//The most interpreter configurations compared in one run.
+# define BENCH_PROGRAMS_MAXIMUM 64																					//The most programs the corpus manifest may list.
+
+/**
+ * A program of the benchmark corpus, along with the input it reads.
+ */
+struct bench_program {
+	char name [ BENCH_NAME_SIZE ] ;																					//The name the results are reported under.
+	char source [ BENCH_NAME_SIZE ] ;																				//The path of the program source file.
+	char input [ BENCH_NAME_SIZE ] ;																				//The path of the program input file, or stdin for no input.
+	long long ops ;																									//The number of commands the program executes, counted without optimizations.
+} ;
+
+/**
+ * The measurements of a single run of the interpreter.
+ */
+struct bench_run {
+	double wall ;																									//The elapsed real time.
+	double cpu ;																									//The user and system CPU time.
+	long long peak_rss ;																							//The peak resident memory, in kilobytes.
+	int status ;																									//The exit status of the interpreter.
+	uint64_t checksum ;																								//The FNV-1a hash of the program output.
+	long long output_bytes ;																						//The size of the program output.
+} ;
+
+/**
+ * The results of a program run with a configuration, as read back from a baseline file.
+ */
+struct bench_baseline {
+	char benchmark [ BENCH_NAME_SIZE ] ;
+	char config [ BENCH_NAME_SIZE ] ;
+	char checksum [ 32 ] ;
+	double wall_min ;
+} ;
+
+/**
+ * The harness options and the state shared by the runs.
+ */
+struct bench_details {
+	char * interpreter ;																							//The path of the interpreter being measured.
+	char * manifest ;																								//The path of the corpus manifest.
+	char * baseline ;																								//The path of the baseline file, or NULL for no comparison.
+	char * only ;																									//The only program to run, or NULL for all of them.
+	int warmup ;																									//The number of runs made before measuring.
+	int repeat ;																									//The number of measured runs.
+	double tolerance ;																								//The fraction by which a run may be slower than the baseline before it is a regression.
+	char configs [ BENCH_CONFIGS_MAXIMUM ] [ BENCH_NAME_SIZE ] ;													//The interpreter options of every configuration.
+	int config_count ;
+	struct bench_program programs [ BENCH_PROGRAMS_MAXIMUM ] ;														//The programs of the corpus.
+	int program_count ;
+	struct bench_baseline * baselines ;																				//The results read from the baseline file.
+	int baseline_count ;
+	char output [ BENCH_NAME_SIZE ] ;																				//The temporary file the program output is written to.
+} ;
+
+/**
+ * The harness variable containing the options and the corpus.
+ */
+struct bench_details bench ;
+
+/**
+ * The option function that reads a harness option given on the command line.
+ * Returns 1 ( true ) if the option was valid.
+ */
+int bench_options ( char * ) ;
+
+/**
+ * The loader function that reads the corpus manifest, resolving the paths in it relative to the manifest.
+ */
+void bench_load ( ) ;
+
+/**
+ * The loader function that reads the results of a previous run from the baseline file.
+ */
+void bench_load_baseline ( ) ;
+
+/**
+ * The execution function that runs the interpreter once with the given options on a program, and measures it.
+ * If the time argument is given, the interpreter also reports its statistics at the end of the output.
+ */
+struct bench_run bench_exec ( struct bench_program * , const char * , int ) ;
+
+/**
+ * The counting function that finds the number of commands a program executes, from the statistics of an unoptimized, profiled run.
+ */
+long long bench_count ( struct bench_program * ) ;
+
+/**
+ * The output function that writes the results of a program run with a configuration as a JSON object.
+ * The time is compared with the baseline relative to that of the first configuration, so that the comparison holds on any machine. The first configuration sets the reference time when none is given.
+ * Returns 1 ( true ) if the results are a regression or the output differs from what was expected.
+ */
+int bench_report ( struct bench_program * , const char * , struct bench_run * , int , uint64_t , int , double * ) ;
+
+/**
+ * The lookup function that finds the results of the given program and configuration in the baseline.
+ * Returns the results, or NULL if the baseline does not hold them.
+ */
+struct bench_baseline * bench_find_baseline ( const char * , const char * ) ;
+
+/**
+ * The main function that starts the harness.
+ */
+int main ( int argc , char * argv [ ] ) {
+	char * arguments [ 3 ] ;
+	int argument_count = 0 , index , config , program , run , failed = 0 , first = 1 ;
+	const char * defaults [ ] = { "--optimize=0" , "--optimize=1" , "--optimize=2" , "--optimize=3" , "--engine=jit" } ;
+	bench . warmup = 1 ;																							//Set the options to their defaults before reading the given ones.
+	bench . repeat = 5 ;
+	bench . tolerance = 0.10 ;
+	bench . baseline = NULL ;
+	bench . only = NULL ;
+	bench . config_count = 0 ;
+	for ( index = 0 ; index < argc ; index ++ ) {																	//Go through the command line, separating the options from the arguments.
+		if ( ( index > 0 ) && ( ! strncmp ( argv [ index ] , "--" , 2 ) ) ) {										//Check if the argument is an option.
+			if ( ! bench_options ( argv [ index ] ) ) {
+				argument_count = 0 ;																				//Forget the arguments so the correct usage is shown.
+				break ;
+			}
+		}
+		else if ( argument_count < 3 ) {
+			arguments [ argument_count ++ ] = argv [ index ] ;
+		}
+		else {
+			argument_count ++ ;
+		}
+	}
+	if ( ( argument_count < 2 ) || ( argument_count > 3 ) ) {														//Check if an interpreter has been provided to measure.
+		printf ( "Usage: %s [--warmup=<runs>] [--repeat=<runs>] [--config=<interpreter options>]... [--only=<benchmark>] [--baseline=<file>] [--tolerance=<percent>] <interpreter> [<corpus manifest>]"
+			, argv [ 0 ] ) ;
+		return -1 ;
+	}
+	bench . interpreter = arguments [ 1 ] ;
+	bench . manifest = ( argument_count >= 3 ) ? arguments [ 2 ] : "bench/corpus.txt" ;
+	if ( bench . config_count == 0 ) {																				//Use the default configurations if none were given.
+		for ( config = 0 ; config < ( int ) ( sizeof ( defaults ) / sizeof ( defaults [ 0 ] ) ) ; config ++ ) {
+			strcpy ( bench . configs [ bench . config_count ++ ] , defaults [ config ] ) ;
+		}
+	}
+	sprintf ( bench . output , "/tmp/brainf-bench-%ld.out" , ( long ) getpid ( ) ) ;
+	bench_load ( ) ;
+	bench_load_baseline ( ) ;
+
+	printf ( "{\n\t\"interpreter\" : \"%s\" ,\n\t\"warmup\" : %d ,\n\t\"repeat\" : %d ,\n\t\"tolerance\" : %.3f ,\n\t\"results\" : [\n" , bench . interpreter , bench . warmup , bench . repeat , bench . tolerance ) ;
+	for ( program = 0 ; program < bench . program_count ; program ++ ) {											//Go through the programs of the corpus.
+		struct bench_program * current = & bench . programs [ program ] ;
+		double reference = 0 ;																						//The time of the first configuration, which the others are compared relative to.
+		uint64_t expected = 0 ;
+		int has_expected = 0 ;
+		if ( ( bench . only != NULL ) && strcmp ( bench . only , current -> name ) ) {
+			continue ;
+		}
+		current -> ops = bench_count ( current ) ;
+		for ( config = 0 ; config < bench . config_count ; config ++ ) {											//Go through the configurations, measuring each.
+			struct bench_run runs [ 256 ] ;
+			fprintf ( stderr , "%s %s\n" , current -> name , bench . configs [ config ] ) ;
+			for ( run = 0 ; run < bench . warmup ; run ++ ) {
+				bench_exec ( current , bench . configs [ config ] , 0 ) ;
+			}
+			for ( run = 0 ; run < bench . repeat ; run ++ ) {
+				runs [ run ] = bench_exec ( current , bench . configs [ config ] , 0 ) ;
+			}
+			if ( ! has_expected ) {																					//Check the output of every other configuration against the first one.
+				expected = runs [ 0 ] . checksum ;
+				has_expected = 1 ;
+			}
+			printf ( first ? "" : " ,\n" ) ;
+			first = 0 ;
+			failed |= bench_report ( current , bench . configs [ config ] , runs , bench . repeat , expected , has_expected , & reference ) ;
+		}
+	}
+	printf ( "\n\t]\n}\n" ) ;
+	remove ( bench . output ) ;
+	free ( bench . baselines ) ;
+	return failed ;																									//Return 1 if there was a regression or a wrong output.
+}
+
+int bench_options ( char * option ) {
+	if ( ! strncmp ( option , "--warmup=" , 9 ) ) {
+		bench . warmup = atoi ( option + 9 ) ;
+		return bench . warmup >= 0 ;
+	}
+	if ( ! strncmp ( option , "--repeat=" , 9 ) ) {
+		bench . repeat = atoi ( option + 9 ) ;
+		return ( bench . repeat > 0 ) && ( bench . repeat <= 256 ) ;
+	}
+	if ( ! strncmp ( option , "--config=" , 9 ) ) {																	//Check if the option adds a configuration, made of interpreter options separated by spaces.
+		if ( ( bench . config_count == BENCH_CONFIGS_MAXIMUM ) || ( strlen ( option + 9 ) >= BENCH_NAME_SIZE ) ) {
+			return 0 ;
+		}
+		strcpy ( bench . configs [ bench . config_count ++ ] , option + 9 ) ;
+		return 1 ;
+	}
+	if ( ! strncmp ( option , "--only=" , 7 ) ) {
+		bench . only = option + 7 ;
+		return 1 ;
+	}
+	if ( ! strncmp ( option , "--baseline=" , 11 ) ) {
+		bench . baseline = option + 11 ;
+		return 1 ;
+	}
+	if ( ! strncmp ( option , "--tolerance=" , 12 ) ) {
+		bench . tolerance = atof ( option + 12 ) / 100 ;
+		return bench . tolerance >= 0 ;
+	}
+	return 0 ;																										//Return 0 ( false ) as the option is unknown.
+}
+
+/**
+ * The path function that resolves a path from the corpus manifest relative to the directory of the manifest, into a buffer of BENCH_NAME_SIZE bytes.
+ * Returns 1 ( true ) if the resolved path fits.
+ */
+int bench_path ( char * resolved , const char * path ) {
+	const char * slash = strrchr ( bench . manifest , '/' ) ;
+	int length ;
+	if ( ( path [ 0 ] == '/' ) || ( slash == NULL ) || ( ! strcmp ( path , "stdin" ) ) ) {							//Check if the path does not depend on where the manifest is.
+		length = snprintf ( resolved , BENCH_NAME_SIZE , "%s" , path ) ;
+	}
+	else {
+		length = snprintf ( resolved , BENCH_NAME_SIZE , "%.*s/%s" , ( int ) ( slash - bench . manifest ) , bench . manifest , path ) ;
+	}
+	return ( length >= 0 ) && ( length < BENCH_NAME_SIZE ) ;
+}
+
+void bench_load ( ) {
+	char line [ 4 * BENCH_NAME_SIZE ] , name [ BENCH_NAME_SIZE ] , source [ BENCH_NAME_SIZE ] , input [ BENCH_NAME_SIZE ] ;
+	FILE * manifest = fopen ( bench . manifest , "r" ) ;
+	bench . program_count = 0 ;
+	if ( manifest == NULL ) {
+		fprintf ( stderr , "Corpus manifest %s doesn't exist.\n" , bench . manifest ) ;
+		exit ( -2 ) ;
+	}
+	while ( fgets ( line , sizeof ( line ) , manifest ) != NULL ) {													//Read a program from every line that is not empty or a comment.
+		int fields = sscanf ( line , "%255s %255s %255s" , name , source , input ) ;
+		if ( ( fields < 2 ) || ( name [ 0 ] == '#' ) || ( bench . program_count == BENCH_PROGRAMS_MAXIMUM ) ) {
+			continue ;
+		}
+		struct bench_program * program = & bench . programs [ bench . program_count ++ ] ;
+		strcpy ( program -> name , name ) ;
+		if ( ( ! bench_path ( program -> source , source ) ) || ( ! bench_path ( program -> input , ( fields == 3 ) ? input : "stdin" ) ) ) {	//Check if the paths are too long once resolved.
+			fprintf ( stderr , "Corpus path of %s is too long.\n" , name ) ;
+			exit ( -2 ) ;
+		}
+	}
+	fclose ( manifest ) ;
+}
+
+/**
+ * The parse function that finds the value of the given key in a line of JSON.
+ * Returns a pointer to the value, or NULL if the key is not in the line.
+ */
+const char * bench_field ( const char * line , const char * key ) {
+	char pattern [ BENCH_NAME_SIZE ] ;
+	const char * found ;
+	sprintf ( pattern , "\"%s\" : " , key ) ;
+	found = strstr ( line , pattern ) ;
+	return ( found != NULL ) ? found + strlen ( pattern ) : NULL ;
+}
+
+/**
+ * The parse function that copies the JSON string value of the given key in a line.
+ */
+void bench_field_string ( const char * line , const char * key , char * value , size_t size ) {
+	const char * found = bench_field ( line , key ) ;
+	size_t length = 0 ;
+	value [ 0 ] = '\0' ;
+	if ( ( found == NULL ) || ( * found != '"' ) ) {
+		return ;
+	}
+	found ++ ;
+	while ( ( found [ length ] != '"' ) && ( found [ length ] != '\0' ) && ( length + 1 < size ) ) {
+		value [ length ] = found [ length ] ;
+		length ++ ;
+	}
+	value [ length ] = '\0' ;
+}
+
+void bench_load_baseline ( ) {
+	char line [ 8 * BENCH_NAME_SIZE ] ;
+	int capacity = 0 ;
+	FILE * baseline ;
+	bench . baselines = NULL ;
+	bench . baseline_count = 0 ;
+	if ( bench . baseline == NULL ) {
+		return ;
+	}
+	baseline = fopen ( bench . baseline , "r" ) ;
+	if ( baseline == NULL ) {
+		fprintf ( stderr , "Baseline file %s doesn't exist.\n" , bench . baseline ) ;
+		exit ( -3 ) ;
+	}
+	while ( fgets ( line , sizeof ( line ) , baseline ) != NULL ) {													//Read the results from every line holding a result object.
+		const char * wall = bench_field ( line , "wall_min" ) ;
+		if ( ( bench_field ( line , "benchmark" ) == NULL ) || ( wall == NULL ) ) {
+			continue ;
+		}
+		if ( bench . baseline_count == capacity ) {
+			capacity = capacity ? capacity * 2 : 64 ;
+			bench . baselines = ( struct bench_baseline * ) realloc ( bench . baselines , capacity * sizeof ( struct bench_baseline ) ) ;
+			if ( bench . baselines == NULL ) {
+				fprintf ( stderr , "Not enough memory for the baseline.\n" ) ;
+				exit ( -5 ) ;
+			}
+		}
+		struct bench_baseline * result = & bench . baselines [ bench . baseline_count ++ ] ;
+		bench_field_string ( line , "benchmark" , result -> benchmark , sizeof ( result -> benchmark ) ) ;
+		bench_field_string ( line , "config" , result -> config , sizeof ( result -> config ) ) ;
+		bench_field_string ( line , "checksum" , result -> checksum , sizeof ( result -> checksum ) ) ;
+		result -> wall_min = atof ( wall ) ;
+	}
+	fclose ( baseline ) ;
+}
+
+struct bench_run bench_exec ( struct bench_program * program , const char * config , int time ) {
+	struct bench_run run ;
+	struct timespec start , end ;
+	struct rusage usage ;
+	char options [ BENCH_NAME_SIZE ] ;
+	char * arguments [ BENCH_ARGUMENTS_MAXIMUM ] ;
+	int count = 0 , status = 0 ;
+	char * option ;
+	pid_t child ;
+	strcpy ( options , config ) ;
+	arguments [ count ++ ] = bench . interpreter ;
+	for ( option = strtok ( options , " " ) ; ( option != NULL ) && ( count < BENCH_ARGUMENTS_MAXIMUM - 6 ) ; option = strtok ( NULL , " " ) ) {	//Split the configuration into its options.
+		arguments [ count ++ ] = option ;
+	}
+	arguments [ count ++ ] = program -> source ;
+	arguments [ count ++ ] = bench . output ;
+	arguments [ count ++ ] = program -> input ;
+	if ( time ) {
+		arguments [ count ++ ] = "time" ;
+	}
+	arguments [ count ] = NULL ;
+	memset ( & run , 0 , sizeof ( run ) ) ;
+	clock_gettime ( CLOCK_MONOTONIC , & start ) ;
+	child = fork ( ) ;
+	if ( child == 0 ) {																								//Run the interpreter in the child, with no terminal input or output.
+		int null = open ( "/dev/null" , O_RDWR ) ;
+		dup2 ( null , STDIN_FILENO ) ;
+		dup2 ( null , STDOUT_FILENO ) ;
+		execv ( bench . interpreter , arguments ) ;
+		_exit ( 127 ) ;
+	}
+	if ( ( child < 0 ) || ( wait4 ( child , & status , 0 , & usage ) < 0 ) ) {
+		fprintf ( stderr , "The interpreter %s could not be run.\n" , bench . interpreter ) ;
+		exit ( -6 ) ;
+	}
+	clock_gettime ( CLOCK_MONOTONIC , & end ) ;
+	run . wall = ( end . tv_sec - start . tv_sec ) + ( end . tv_nsec - start . tv_nsec ) / 1e9 ;
+	run . cpu = usage . ru_utime . tv_sec + usage . ru_utime . tv_usec / 1e6 + usage . ru_stime . tv_sec + usage . ru_stime . tv_usec / 1e6 ;
+# if defined ( __APPLE__ )
+	run . peak_rss = usage . ru_maxrss / 1024 ;																		//The peak memory is counted in bytes on macOS.
+# else
+	run . peak_rss = usage . ru_maxrss ;
+# endif
+	run . status = WIFEXITED ( status ) ? WEXITSTATUS ( status ) : -1 ;
+	run . checksum = 14695981039346656037ULL ;																		//Hash the program output with FNV-1a.
+	FILE * output = fopen ( bench . output , "rb" ) ;
+	if ( output != NULL ) {
+		int value ;
+		while ( ( value = fgetc ( output ) ) != EOF ) {
+			run . checksum = ( run . checksum ^ ( uint64_t ) value ) * 1099511628211ULL ;
+			run . output_bytes ++ ;
+		}
+		fclose ( output ) ;
+	}
+	return run ;
+}
+
+long long bench_count ( struct bench_program * program ) {
+	char line [ BENCH_NAME_SIZE ] ;
+	long long ops = 0 ;
+	FILE * output ;
+	bench_exec ( program , "--optimize=0 --prefix=0 --engine=interpreter --profile" , 1 ) ;							//Every instruction is a single command when nothing is optimized, and none are run ahead of time. Only the profiled runs count them.
+	output = fopen ( bench . output , "rb" ) ;
+	if ( output == NULL ) {
+		return 0 ;
+	}
+	while ( fgets ( line , sizeof ( line ) , output ) != NULL ) {													//Find the count in the statistics at the end of the output.
+		if ( ! strncmp ( line , "Instructions executed : " , 24 ) ) {
+			ops = atoll ( line + 24 ) ;
+		}
+	}
+	fclose ( output ) ;
+	return ops ;
+}
+
+struct bench_baseline * bench_find_baseline ( const char * benchmark , const char * config ) {
+	int index ;
+	for ( index = 0 ; index < bench . baseline_count ; index ++ ) {
+		if ( ( ! strcmp ( bench . baselines [ index ] . benchmark , benchmark ) ) && ( ! strcmp ( bench . baselines [ index ] . config , config ) ) ) {
+			return & bench . baselines [ index ] ;
+		}
+	}
+	return NULL ;
+}
+
+int bench_report ( struct bench_program * program , const char * config , struct bench_run * runs , int count , uint64_t expected , int has_expected , double * reference ) {
+	double wall_min = runs [ 0 ] . wall , wall_max = runs [ 0 ] . wall , wall_sum = 0 , cpu_sum = 0 , change = 0 , relative ;
+	long long peak_rss = 0 ;
+	int run , status = 0 ;
+	char checksum [ 32 ] ;
+	const char * verdict = "new" ;
+	struct bench_baseline * baseline = bench_find_baseline ( program -> name , config ) ;
+	struct bench_baseline * baseline_reference = bench_find_baseline ( program -> name , bench . configs [ 0 ] ) ;
+	for ( run = 0 ; run < count ; run ++ ) {
+		wall_min = ( runs [ run ] . wall < wall_min ) ? runs [ run ] . wall : wall_min ;
+		wall_max = ( runs [ run ] . wall > wall_max ) ? runs [ run ] . wall : wall_max ;
+		wall_sum += runs [ run ] . wall ;
+		cpu_sum += runs [ run ] . cpu ;
+		peak_rss = ( runs [ run ] . peak_rss > peak_rss ) ? runs [ run ] . peak_rss : peak_rss ;
+		status = ( runs [ run ] . status != 0 ) ? runs [ run ] . status : status ;
+		if ( runs [ run ] . checksum != runs [ 0 ] . checksum ) {													//Check if the output changed between runs.
+			status = -1 ;
+		}
+	}
+	if ( * reference <= 0 ) {																						//Take the time of the first configuration as the reference.
+		* reference = ( wall_min > 0 ) ? wall_min : 1e-9 ;
+	}
+	relative = wall_min / * reference ;
+	sprintf ( checksum , "%016llx" , ( unsigned long long ) runs [ 0 ] . checksum ) ;
+	if ( baseline != NULL ) {																						//Check if the baseline holds the same program and configuration.
+		double baseline_relative = ( ( baseline_reference != NULL ) && ( baseline_reference -> wall_min > 0 ) ) ? baseline -> wall_min / baseline_reference -> wall_min : 0 ;
+		change = ( baseline_relative > 0 ) ? ( relative - baseline_relative ) / baseline_relative : 0 ;				//Compare the times relative to the first configuration, which cancels out the speed of the machine.
+		if ( strcmp ( baseline -> checksum , checksum ) ) {
+			verdict = "mismatch" ;
+		}
+		else if ( change > bench . tolerance ) {
+			verdict = "regression" ;
+		}
+		else if ( change < - bench . tolerance ) {
+			verdict = "improvement" ;
+		}
+		else {
+			verdict = "ok" ;
+		}
+	}
+	if ( ( has_expected && ( runs [ 0 ] . checksum != expected ) ) || ( status != 0 ) ) {							//Check if the output differs from the other configurations, or the interpreter failed.
+		verdict = "mismatch" ;
+	}
+	printf ( "\t\t{ \"benchmark\" : \"%s\" , \"config\" : \"%s\" , \"runs\" : %d , "
+		"\"wall_min\" : %.6f , \"wall_mean\" : %.6f , \"wall_max\" : %.6f , \"cpu_mean\" : %.6f , "
+		"\"ops\" : %lld , \"ops_per_sec\" : %.0f , \"peak_rss_kb\" : %lld , \"output_bytes\" : %lld , \"checksum\" : \"%s\" , "
+		"\"relative\" : %.4f , \"status\" : %d , \"change\" : %.4f , \"verdict\" : \"%s\" }" ,
+		program -> name , config , count , wall_min , wall_sum / count , wall_max , cpu_sum / count ,
+		program -> ops , ( wall_sum > 0 ) ? program -> ops / ( wall_sum / count ) : 0.0 , peak_rss , runs [ 0 ] . output_bytes , checksum ,
+		relative , status , change , verdict ) ;
+	fflush ( stdout ) ;
+	fprintf ( stderr , "\t%-12s %-40s %10.4f s %14.0f ops/s %8lld KB %s\n" , program -> name , config , wall_min ,
+		( wall_sum > 0 ) ? program -> ops / ( wall_sum / count ) : 0.0 , peak_rss , verdict ) ;
+	return ( ! strcmp ( verdict , "regression" ) ) || ( ! strcmp ( verdict , "mismatch" ) ) ;
+}
@@ -0,0 +1,3 @@
+TARGET = bench
+SOURCES += bench.c
+QMAKE_CFLAGS += -Wall -Wextra -Wshadow -pedantic -Werror -std=c99
\ No newline at end of file
@@ -0,0 +1,29 @@
+Towers of Hanoi for 18 disks
+Solved recursively with an explicit stack of frames on the tape
+Prints every move as the disk followed by the pegs it moves between
+
+>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]++++++++++++++++++>[-]+>[-]+++>[-]++<<<<<[>>>>>
+>[->+>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<>+<[>-]>[<<
+<<<<[->>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>]>>>>>[-]<<<>+<[>-]>[<>>>[-]+<<<>->]<<[-]>>>>[-]+<[<<<<<<<<<<<<<<<<<<<[-]>
+[-]>[-]>[-]>[-]<<<<<<[-]>[-]+>>>>>>>>>>>>>>>>>>>>>[-]<[-]]>[<<<<<<<<<<<<<<<<[-]+
+>>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>>>>>>>>>-<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<+<<<<<<<<<<<<<]>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>
+>>>]>>>>>>[-]]<<<<<<<<<<<<<<<>->]<<->+<[>-]>[<<<<<<[->>>>>>>>+>>>>>>+<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<[-]>[-]++++++++++<<[->>->
++<[>-]>[<<+>[-]++++++++++>->]<<<<]>>>>>[-]++++++++++<<<[->>>-<<<]<[+++++++++++++
++++++++++++++++++++++++++++++++++++.[-]]>>>>++++++++++++++++++++++++++++++++++++
+++++++++++++.[-]>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.-
+-------------------------.[-]<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++.-----------------------------------------------------
+----------->>>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++.+++++++++++++.++++++
++++++++++++.------------------------------.[-]<<<<<<<<<<<<++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++.-------------------------------------
+--------------------------->>>>>>>>>>>>[-]++++++++++.[-]<<<<<<<<<<<<<<->[->>>>>>
+>>>>>>>+<<<<<<<<<<<<<]>>[-<<+>>]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<[
+-]>>->]<<+[-]<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>[>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<<<<>[<<<<<<<<<<<<<<<<<<<<<<<<]<]
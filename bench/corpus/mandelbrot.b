@@ -0,0 +1,91 @@
+Mandelbrot set drawn in ASCII art
+Fixed point arithmetic with a scale of 16 on two's complement cells
+Up to 100 iterations for every one of the 41 by 19 points
+
+[-]+++++++++++++++++++>>[-]------------------<<[->>>[-]-------------------------
+-------<<[-]+++++++++++++++++++++++++++++++++++++++++[->>>[-]>[-]>[-]>[-]+>[-]++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++<[<<<[->>>>>>>+>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[-]>[-]
++<<<<[-]++++++++++++++++++++++++++++++++>>>>[<<<<<<<<<<>+<[>-]>[<>>>>>>>>>>[-]<<
+<<<<<<<<>->]<<>>>>+<[>-]>[<>>>>>>>[-]>>>[-]+<<<<<<<<<<>->]<<>>>>+<[>-]>[<>>>>[-]
+>>>>>[-]+<<<<<<<<<>->]<<<<<<<<->>>+>>>>>>+<<<->>>>]<[->>+<<]>>-<<<<<<<<<<<[-]>>>
+[-]>>>[-]<<<<<<<<<<<<[->>>>>>+>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[-]>[-]+<<<<[-
+]++++++++++++++++++++++++++++++++>>>>[<<<<<<<<<<>+<[>-]>[<>>>>>>>>>>[-]<<<<<<<<<
+<>->]<<>>>>+<[>-]>[<>>>>>>>[-]>>>>[-]+<<<<<<<<<<<>->]<<>>>>+<[>-]>[<>>>>[-]>>>>>
+[-]+<<<<<<<<<>->]<<<<<<<<->>>+>>>>>>+<<<->>>>]<[->>>+<<<]>>>-<<<<<<<<<<<<[-]>>>[
+-]>>>[-]>>>>>>>>>>[-]+<[>[-]<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>[-]]>[>>[-
+]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>[-]+++++++++
++++++++<<<<<<<<<<[->>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>>>+<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]
+<<<[-<<<<<<->+<[>-]>[<[-]++++++++++++++++>>>+<<<<<<->+<[>-]>[<<[-]+>>->]<<>>>>->
+]<<>>>>>>]>]<<<<<<<[-][-]++++++++++++++++<<<<<<<<<[->>>>>>>>>>>>>>>>+>+<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>>>]<<<[-<<<<<<->+<[>-]>[<[-]++++++++++++++++>>>>+<<<<<<<->+<[
+>-]>[<<[-]+>>->]<<>>>>->]<<>>>>>>]>]<<<<<<<[-]<<<<<[-]+>[<[-]<<<<<<<<<<<<<<<<<<<
+<[-]>>>>>>>>>>>>>>>>>>>>>[-]]<[<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[->+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<[-]++++++++<<<<<<<<<[-
+>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<]>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<<<[-<<<<<<->+<[>-]>[<[-
+]++++++++>>>>>+<<<<<>->]<<>>>>>>]>]<<<<<<<[-]>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>[>>>>>>>>>>>>>>>>>[-<<+>>][-]+<<[->>-<<]<<<
+<<<<<<<<<<<<[-]]<<<<<<<<<<<<<<<<<<<<[-]<<<[->>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+]>>[<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>
+>>[-]]<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>->+<[>-]>[<<[-]>>->]<<>>>>>>>>>>>>>>>>>>>[-]][-
+]]>>>>>>>>[-]>[-]<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>>>>[-]<<<<<<<<<<<<<<<<<<<<<<]>[-]
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++>>[-]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<+
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>[-]+<<[->>->+
+<[>-]>[<<[-]+>>->]<<<<]>>[-]<[<<[-]+++++++++++++++++++++++++++++++++++++++++++++
++>>[-]][-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<<<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>
+>>[-]++<<[->>->+<[>-]>[<<[-]+>>->]<<<<]>>[-]<[<<[-]+++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++>>[-]][-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>[-]+++<<[->>->+<[>-]>[<<[-]+>>->]<<<<]>>[-]<[<<[-]
++++++++++++++++++++++++++++++++++++++++++++++>>[-]][-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<+<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>[-]+++++<<[->>->+<[>-]>[<<[-]+>>->
+]<<<<]>>[-]<[<<[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>
+>[-]][-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>+<<<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>
+[-]++++++++<<[->>->+<[>-]>[<<[-]+>>->]<<<<]>>[-]<[<<[-]+++++++++++++++++++++++++
+++++++++++++++++++>>[-]][-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>]>>>>>>[-]+++++++++++++<<[->>->+<[>-]>[<<[-]+>>->]<<<<]>>[-]<[<<[-]+
++++++++++++++++++++++++++++++++++++++++++>>[-]][-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>[-]+++++++++++++++++++++<<[->>->+<[>-]
+>[<<[-]+>>->]<<<<]>>[-]<[<<[-]+++++++++++++++++++++++++++++++++++++>>[-]][-]<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<
++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>[-]+++++++++
++++++++++++++++++++++++++<<[->>->+<[>-]>[<<[-]+>>->]<<<<]>>[-]<[<<[-]+++++++++++
+++++++++++++++++++++++++>>[-]][-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>]>>>>>>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++<<[->>->+<[>-]>[<<[-]+>>->]<<<<]
+>>[-]<[<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>[-
+]]<<.<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[-]++++++++++.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++<<]
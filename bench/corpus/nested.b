@@ -0,0 +1,35 @@
+Nested loop stress test
+Six loops of 12 iterations and then twenty loops of 2 iterations
+Each innermost iteration increments a 24 bit counter printed at the end
+
+>>>>>>>>[-]++++++++++++++++++++++++++++++++++++++++++++++>[-]++++++++++++[->[-]+
++++++++++++[->[-]++++++++++++[->[-]++++++++++++[->[-]++++++++++++[->[-]+++++++++
++++[-<<<<<<<<<<<<<+>+<[>-]>[<>>>+>+<[>-]>[<>>>+<<<>->]<<<<<>->]<<>>>>>>>>>>>>>]<
+]<]<]<<<.>>]<<<<<<<<<<[-]++++++++++.[-]>>>>>>>>>]>>>>>>[-]++[->[-]++[->[-]++[->[
+-]++[->[-]++[->[-]++[->[-]++[->[-]++[->[-]++[->[-]++[->[-]++[->[-]++[->[-]++[->[
+-]++[->[-]++[->[-]++[->[-]++[->[-]++[->[-]++[->[-]++[-<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>+<[>-]>[<>>>+>+<[>-]>[<>>>+<<<>->]<<<<<>->]<<>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>]<]<]<]<]<]<]<]<]<<<<<<<<<<<<<<<<<<.>>>>>>>>>>>>>>>>>]<]<]<]<]<<<<<<<<<<<
+<<<<<<<<<<[-]++++++++++.[-]>>>>>>>>>>>>>>>>>>>>]<]<]<]<]<]<<<<<<<<>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-]++++++++++++++++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>->+<[>-]>[<<+>[-]++++++++++++++++>->]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++.>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++.[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-]++++++++++++++++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>->+<[>-]>[<<+>[-]++++++++++++++++>->]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.>[-<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>->+<[>-]>[<<+>[-]+++++++++
++++++++>->]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++.>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++.[-][-]++++++++++.[-]
@@ -0,0 +1,661 @@
+/**
+ * Brainfuck Compiler
+ *
+ * Takes a single input file and compiles the program ahead of time into C or x86-64 assembly, and optionally into an executable using the system C compiler.
+ * The compiled program takes the same program output file, program input file and time arguments as the interpreter.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# if ! defined ( _DEFAULT_SOURCE )
+	# define _DEFAULT_SOURCE 1																						//Needed for the POSIX process functions.
+# endif
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <unistd.h>
+# include <sys/types.h>
+# include <sys/wait.h>
+# include "struct.h"
+# include "program.h"
+# include "prefix.h"
+# include "bounds.h"
+
+# define COMPILER_PATH_SIZE 65536																					//The longest path of a temporary file, and the longest system C compiler command.
+# define COMPILER_ARGUMENTS_MAXIMUM 256																				//The most words of the system C compiler command, along with the arguments passed to it.
+
+/**
+ * The program variable containing all the needed details of the program currently being compiled.
+ */
+struct program_details program ;
+
+/**
+ * The error function to handle any errors encountered, which shows the error and exits.
+ */
+void error_procedure ( ) {
+	fprintf ( program . progout , "\n\n------------------" ) ;
+	fprintf ( program . progout , "\nERROR : %s" , program . file . message ) ;
+	fprintf ( program . progout , "\nLOCATION : Byte %llu" , program . file . pointer . position ) ;
+	fprintf ( program . progout , "\n------------------\n\n" ) ;
+	exit ( program . file . status ) ;
+}
+
+/**
+ * The source of the runtime that every compiled program is built with.
+ * It holds the program list, grows it, scans it, and does the input and output, while the compiled function bf_run holds the program itself.
+ */
+const char * compiler_runtime [ ] = {
+	"# include <stdint.h>" ,
+	"# include <stdio.h>" ,
+	"# include <stdlib.h>" ,
+	"# include <string.h>" ,
+	"# include <time.h>" ,
+	"" ,
+	"struct bf_table {" ,
+	"\tuintptr_t low ;" ,
+	"\tuintptr_t span ;" ,
+	"} ;" ,
+	"" ,
+	"extern const long long bf_margin ;" ,
+	"extern const long long bf_prefix_length , bf_prefix_position , bf_prefix_output_length ;" ,
+	"extern const uint8_t bf_prefix_cells [ ] , bf_prefix_output [ ] ;" ,
+	"uint8_t * bf_run ( struct bf_table * table , uint8_t * cell ) ;" ,
+	"" ,
+	"uint8_t * bf_cells ;" ,
+	"long long bf_size ;" ,
+	"FILE * bf_in , * bf_out ;" ,
+	"" ,
+	"void bf_error ( const char * message , int status ) {" ,
+	"\tfprintf ( stderr , \"\\n\\n------------------\" ) ;" ,
+	"\tfprintf ( stderr , \"\\nERROR : %s\" , message ) ;" ,
+	"\tfprintf ( stderr , \"\\nLOCATION : Byte 0\" ) ;" ,
+	"\tfprintf ( stderr , \"\\n------------------\\n\\n\" ) ;" ,
+	"\texit ( status ) ;" ,
+	"}" ,
+	"" ,
+	"long long bf_reserve ( struct bf_table * table , long long position ) {" ,
+	"\twhile ( ( position - bf_margin < 0 ) || ( position + bf_margin >= bf_size ) ) {" ,
+	"\t\tuint8_t * cells = ( uint8_t * ) realloc ( bf_cells , 2 * bf_size ) ;" ,
+	"\t\tif ( cells == NULL ) {" ,
+	"\t\t\tbf_error ( \"Not enough memory for the program list.\" , -5 ) ;" ,
+	"\t\t}" ,
+	"\t\tif ( position - bf_margin < 0 ) {" ,
+	"\t\t\tmemmove ( cells + bf_size , cells , bf_size ) ;" ,
+	"\t\t\tmemset ( cells , 0 , bf_size ) ;" ,
+	"\t\t\tposition += bf_size ;" ,
+	"\t\t}" ,
+	"\t\telse {" ,
+	"\t\t\tmemset ( cells + bf_size , 0 , bf_size ) ;" ,
+	"\t\t}" ,
+	"\t\tbf_cells = cells ;" ,
+	"\t\tbf_size *= 2 ;" ,
+	"\t}" ,
+	"\ttable -> low = ( uintptr_t ) ( bf_cells + bf_margin ) ;" ,
+	"\ttable -> span = ( uintptr_t ) ( bf_size - 2 * bf_margin ) ;" ,
+	"\treturn position ;" ,
+	"}" ,
+	"" ,
+	"uint8_t * bf_grow ( struct bf_table * table , uint8_t * cell ) {" ,
+	"\tlong long position = ( long long ) ( ( uintptr_t ) cell - ( uintptr_t ) bf_cells ) ;" ,
+	"\tposition = bf_reserve ( table , position ) ;" ,
+	"\treturn bf_cells + position ;" ,
+	"}" ,
+	"" ,
+	"uint8_t * bf_scan ( struct bf_table * table , uint8_t * cell , long long stride ) {" ,
+	"\tlong long position = cell - bf_cells ;" ,
+	"\tif ( stride == 1 ) {" ,
+	"\t\tuint8_t * found = ( uint8_t * ) memchr ( cell , 0 , bf_size - position ) ;" ,
+	"\t\tposition = ( found != NULL ) ? ( found - bf_cells ) : bf_size ;" ,
+	"\t}" ,
+	"\telse {" ,
+	"\t\twhile ( ( position >= 0 ) && ( position < bf_size ) && ( bf_cells [ position ] != 0 ) ) {" ,
+	"\t\t\tposition += stride ;" ,
+	"\t\t}" ,
+	"\t}" ,
+	"\tposition = bf_reserve ( table , position ) ;" ,
+	"\treturn bf_cells + position ;" ,
+	"}" ,
+	"" ,
+	"void bf_output ( int value ) {" ,
+	"\tputc ( value , bf_out ) ;" ,
+	"}" ,
+	"" ,
+	"int bf_input ( ) {" ,
+	"\treturn getc ( bf_in ) ;" ,
+	"}" ,
+	"" ,
+	"int main ( int argc , char * argv [ ] ) {" ,
+	"\tstruct bf_table table ;" ,
+	"\tlong long position ;" ,
+	"\tclock_t start ;" ,
+	"\tif ( argc > 4 ) {" ,
+	"\t\tprintf ( \"Usage: %s [<program output file> [<program input file> [time]]]\" , argv [ 0 ] ) ;" ,
+	"\t\treturn -1 ;" ,
+	"\t}" ,
+	"\tbf_out = stdout ;" ,
+	"\tbf_in = stdin ;" ,
+	"\tif ( ( argc >= 2 ) && ( strcmp ( argv [ 1 ] , \"stdout\" ) ) ) {" ,
+	"\t\tbf_out = fopen ( argv [ 1 ] , \"wb\" ) ;" ,
+	"\t\tif ( bf_out == NULL ) {" ,
+	"\t\t\tbf_error ( \"Program output file couldn't be opened.\" , -3 ) ;" ,
+	"\t\t}" ,
+	"\t}" ,
+	"\tif ( ( argc >= 3 ) && ( strcmp ( argv [ 2 ] , \"stdin\" ) ) ) {" ,
+	"\t\tbf_in = fopen ( argv [ 2 ] , \"rb\" ) ;" ,
+	"\t\tif ( bf_in == NULL ) {" ,
+	"\t\t\tbf_error ( \"Program input file doesn't exist.\" , -3 ) ;" ,
+	"\t\t}" ,
+	"\t}" ,
+	"\tbf_size = 4096 ;" ,
+	"\twhile ( bf_size < bf_prefix_length ) {" ,
+	"\t\tbf_size *= 2 ;" ,
+	"\t}" ,
+	"\tbf_cells = ( uint8_t * ) calloc ( bf_size , sizeof ( uint8_t ) ) ;" ,
+	"\tif ( bf_cells == NULL ) {" ,
+	"\t\tbf_error ( \"Not enough memory for the program list.\" , -5 ) ;" ,
+	"\t}" ,
+	"\tmemcpy ( bf_cells , bf_prefix_cells , bf_prefix_length ) ;" ,
+	"\tposition = bf_reserve ( & table , bf_prefix_position ) ;" ,
+	"\tstart = clock ( ) ;" ,
+	"\tfwrite ( bf_prefix_output , 1 , bf_prefix_output_length , bf_out ) ;" ,
+	"\tbf_run ( & table , bf_cells + position ) ;" ,
+	"\tif ( ( argc >= 4 ) && ( ! strcmp ( argv [ 3 ] , \"time\" ) ) ) {" ,
+	"\t\tfprintf ( bf_out , \"\\n\\n------------------\" ) ;" ,
+	"\t\tfprintf ( bf_out , \"\\nCPU time used : %f\" , ( ( double ) ( clock ( ) - start ) ) / CLOCKS_PER_SEC ) ;" ,
+	"\t\tfprintf ( bf_out , \"\\n------------------\\n\\n\" ) ;" ,
+	"\t}" ,
+	"\tfree ( bf_cells ) ;" ,
+	"\tif ( bf_out != stdout ) {" ,
+	"\t\tfclose ( bf_out ) ;" ,
+	"\t}" ,
+	"\tif ( bf_in != stdin ) {" ,
+	"\t\tfclose ( bf_in ) ;" ,
+	"\t}" ,
+	"\treturn 0 ;" ,
+	"}" ,
+	NULL
+} ;
+
+/**
+ * The option function that reads a compiler option given on the command line.
+ */
+int compiler_options ( char * ) ;
+
+/**
+ * The initializer function that sets up the program variable and opens the program source file.
+ */
+void compiler_init ( char * ) ;
+
+/**
+ * The loader function that reads the program source file and builds the program instructions.
+ */
+void compiler_load ( ) ;
+
+/**
+ * The optimizer function that rewrites the loaded program instructions into fewer, larger instructions.
+ */
+void compiler_optimize ( ) ;
+
+/**
+ * The bounds function that places the list bounds checks of the program instructions, as guards at the start of every stretch.
+ */
+void compiler_bounds ( ) ;
+
+/**
+ * The reach function that finds the farthest cell from the pointer that any instruction accesses, which the assembly output has to address.
+ */
+long long compiler_reach ( ) ;
+
+/**
+ * The output function that writes the runtime the compiled program is built with.
+ */
+void compiler_emit_runtime ( FILE * ) ;
+
+/**
+ * The prefix function that writes the program list and output left by the prefix, which the runtime starts every run from, as C or assembly data.
+ */
+void compiler_emit_prefix ( FILE * , int ) ;
+
+/**
+ * The output function that writes the program as a C function, along with the runtime.
+ */
+void compiler_emit_c ( FILE * ) ;
+
+/**
+ * The output function that writes the program as an x86-64 assembly function, in the GNU assembler syntax.
+ */
+void compiler_emit_asm ( FILE * ) ;
+
+/**
+ * The output function that writes the chosen output to the given file, or to the standard output if none is given.
+ */
+void compiler_write ( char * , int ) ;
+
+/**
+ * The build function that writes the chosen output to temporary files and compiles them into an executable with the system C compiler.
+ */
+void compiler_build ( char * ) ;
+
+/**
+ * The cleanup function that deinitializes everything in the program variable.
+ */
+void compiler_clean ( ) ;
+
+/**
+ * The kinds of output the compiler can write.
+ */
+enum compiler_emit {
+	EMIT_C ,																										//A C source file holding the runtime and the program.
+	EMIT_ASM ,																										//An assembly source file holding the program, to be linked with the runtime.
+	EMIT_RUNTIME																									//A C source file holding the runtime alone.
+} ;
+
+/**
+ * The compiler options given on the command line.
+ */
+enum compiler_emit compiler_emit = EMIT_C ;
+int compiler_executable = 0 ;
+
+/**
+ * The main function that starts the compiler.
+ */
+int main ( int argc , char * argv [ ] ) {
+	char * arguments [ 3 ] ;																						//The arguments given on the command line which are not options.
+	int argument_count = 0 , index ;
+	program . options . optimization_level = OPTIMIZATION_LEVEL_DEFAULT ;											//Set the options to their defaults before reading the given ones.
+	program . options . engine = ENGINE_INTERPRETER ;
+	program . options . prefix_budget = PREFIX_BUDGET_DEFAULT ;
+	program . options . cell = CELL_8 ;																				//The compiled program always has cells of 8 bits.
+	for ( index = 0 ; index < argc ; index ++ ) {																	//Go through the command line, separating the options from the arguments.
+		if ( ( index > 0 ) && ( ! strncmp ( argv [ index ] , "--" , 2 ) ) ) {										//Check if the argument is an option.
+			if ( ! compiler_options ( argv [ index ] ) ) {															//Check if the option is invalid.
+				argument_count = 0 ;																				//Forget the arguments so the correct usage is shown.
+				break ;
+			}
+		}
+		else if ( argument_count < 3 ) {
+			arguments [ argument_count ++ ] = argv [ index ] ;
+		}
+		else {
+			argument_count ++ ;																						//Count the extra argument so the correct usage is shown.
+		}
+	}
+	if ( ( argument_count < 2 ) || ( argument_count > 3 ) ) {														//Check if a program source file has been provided for compilation.
+		printf ( "Usage: %s [--optimize=<level>] [--prefix=<steps>] [--emit=<c|asm|runtime>] [--executable] <source file> [<output file>]"
+			, argv [ 0 ] ) ;																						//If an invalid number of arguments have been provided, the correct usage is shown.
+		return -1 ;																									//Terminate the compiler since nothing else can be done.
+	}
+	char * output = ( ( argument_count >= 3 ) && ( strcmp ( arguments [ 2 ] , "stdout" ) ) ) ? arguments [ 2 ] : NULL ;	//The file into which the compiled output is written, or NULL for the standard output.
+
+	compiler_init ( arguments [ 1 ] ) ;																				//Initialize the compiler.
+	compiler_load ( ) ;																								//Load the program instructions from the source file.
+	compiler_optimize ( ) ;																							//Optimize the program instructions.
+	prefix_evaluate ( & program ) ;																					//Run the start of the program that does not depend on the input, so the compiled program starts from where it left off.
+	compiler_bounds ( ) ;																							//Place the list bounds checks at the start of every stretch of the program.
+	if ( compiler_executable ) {																					//Check if an executable is to be built.
+		compiler_build ( ( output != NULL ) ? output : "a.out" ) ;
+	}
+	else {
+		compiler_write ( output , compiler_emit ) ;
+	}
+
+	compiler_clean ( ) ;																							//Clean up after the compiler.
+
+	return program . file . status ;																				//Return the final program status.
+}
+
+int compiler_options ( char * option ) {
+	if ( optimization_option ( & program . options , option ) ) {													//Check if the option is one shared with the interpreter.
+		return 1 ;
+	}
+	if ( ! strcmp ( option , "--emit=c" ) ) {																		//Check if the option picks C output.
+		compiler_emit = EMIT_C ;
+		return 1 ;
+	}
+	if ( ! strcmp ( option , "--emit=asm" ) ) {																		//Check if the option picks assembly output.
+		compiler_emit = EMIT_ASM ;
+		return 1 ;
+	}
+	if ( ! strcmp ( option , "--emit=runtime" ) ) {																	//Check if the option picks the runtime alone, to link assembly output with.
+		compiler_emit = EMIT_RUNTIME ;
+		return 1 ;
+	}
+	if ( ! strcmp ( option , "--executable" ) ) {																	//Check if the option asks for an executable to be built.
+		compiler_executable = 1 ;
+		return 1 ;
+	}
+	return 0 ;																										//Return 0 ( false ) as the option is unknown.
+}
+
+void compiler_init ( char * program_file ) {
+	program . progout = stdout ;																					//Show any errors on the standard output.
+	program . progin = stdin ;
+	program . file . source = fopen ( program_file , "r" ) ;														//Open the program source file.
+	if ( program . file . source == NULL ) {																		//Check if the file has not been opened.
+		strcpy ( program . file . message , "Source file doesn't exist." ) ;										//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		program . file . status = -2 ;
+		error_procedure ( ) ;
+	}
+	program . file . pointer . position = 0 ;																		//Set the position of the input pointer to 0 ( the start ).
+	program . list . cells = NULL ;																					//The compiler has no program list, since the program is not run.
+	program . list . size = 0 ;
+	program . list . position = 0 ;
+	program . code . instructions = NULL ;																			//Set the program instructions to empty ( since the program has not been loaded yet ).
+	program . code . length = 0 ;
+	program . code . counter = 0 ;
+	program . jit . code = NULL ;
+	program . file . status = 1 ;																					//Set the status to 1 ( meaning compiling ).
+	strcpy ( program . file . message , "Compiling" ) ;																//Set the status message to "Compiling".
+}
+
+void compiler_load ( ) {
+	long long length ;
+	char * source = program_read ( program . file . source , & length ) ;											//Read the whole program source file.
+	fclose ( program . file . source ) ;																			//Close the program source file, since it has been read completely.
+	program . file . source = NULL ;
+	if ( source == NULL ) {																							//Check if the source buffer could not be allocated.
+		strcpy ( program . file . message , "Not enough memory to load the source file." ) ;						//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		program . file . status = -5 ;
+		error_procedure ( ) ;
+	}
+	if ( ! program_load ( & program , source , length ) ) {															//Check if the instructions could not be built, in which case the status and message are already set.
+		free ( source ) ;
+		error_procedure ( ) ;
+	}
+	free ( source ) ;																								//Free the program source since the instructions have been built.
+}
+
+void compiler_optimize ( ) {
+	if ( ! program_optimize ( & program ) ) {																		//Check if the instructions could not be optimized, in which case the status and message are already set.
+		error_procedure ( ) ;
+	}
+}
+
+void compiler_bounds ( ) {
+	if ( ! bounds_analyze ( & program . code ) ) {																	//Check if the guards could not be placed.
+		strcpy ( program . file . message , "Not enough memory for the program instructions." ) ;					//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		program . file . status = -5 ;
+		error_procedure ( ) ;
+	}
+}
+
+long long compiler_reach ( ) {
+	long long margin = 0 , index , reach ;
+	for ( index = 0 ; index < program . code . length ; index ++ ) {												//Go through the program instructions to find the farthest cell accessed.
+		struct program_instruction * instruction = & program . code . instructions [ index ] ;
+		reach = llabs ( instruction -> offset ) > llabs ( instruction -> offset + instruction -> distance ) ?
+			llabs ( instruction -> offset ) : llabs ( instruction -> offset + instruction -> distance ) ;
+		if ( reach > margin ) {
+			margin = reach ;
+		}
+	}
+	return margin ;
+}
+
+void compiler_emit_runtime ( FILE * output ) {
+	int line ;
+	for ( line = 0 ; compiler_runtime [ line ] != NULL ; line ++ ) {
+		fprintf ( output , "%s\n" , compiler_runtime [ line ] ) ;
+	}
+}
+
+/**
+ * The bytes function that writes an array of bytes as C or assembly data, sixteen to a line.
+ */
+void compiler_emit_bytes ( FILE * output , int emit , const char * name , const uint8_t * bytes , long long length ) {
+	long long index ;
+	if ( emit == EMIT_C ) {
+		fprintf ( output , "const uint8_t %s [ ] = {" , name ) ;
+	}
+	else {
+		fprintf ( output , "\t.globl %s\n%s:" , name , name ) ;
+	}
+	for ( index = 0 ; index < length ; index ++ ) {
+		if ( index % 16 == 0 ) {																					//Start a new line every sixteen bytes.
+			fprintf ( output , ( emit == EMIT_C ) ? "%s\n\t" : "\n\t.byte " , ( index != 0 ) ? "," : "" ) ;
+		}
+		else {
+			fprintf ( output , ", " ) ;
+		}
+		fprintf ( output , "%u" , bytes [ index ] ) ;
+	}
+	if ( emit == EMIT_C ) {
+		fprintf ( output , "%s\n} ;\n" , ( length == 0 ) ? "\n\t0" : "" ) ;											//An array in C cannot be empty.
+	}
+	else {
+		fprintf ( output , "%s\n" , ( length == 0 ) ? "\n\t.byte 0" : "" ) ;
+	}
+}
+
+void compiler_emit_prefix ( FILE * output , int emit ) {
+	struct program_prefix * prefix = & program . prefix ;
+	if ( emit == EMIT_C ) {
+		fprintf ( output , "\n/* The state left by the first %lld instructions, run when the program was compiled. */\n" , prefix -> executed ) ;
+		fprintf ( output , "const long long bf_prefix_length = %lld ;\nconst long long bf_prefix_position = %lld ;\nconst long long bf_prefix_output_length = %lld ;\n" ,
+			prefix -> length , prefix -> position , prefix -> output_length ) ;
+	}
+	else {
+		fprintf ( output , "# The state left by the first %lld instructions, run when the program was compiled.\n" , prefix -> executed ) ;
+		fprintf ( output , "\t.globl bf_prefix_length\n\t.globl bf_prefix_position\n\t.globl bf_prefix_output_length\n\t.p2align 3\n" ) ;
+		fprintf ( output , "bf_prefix_length:\n\t.quad %lld\nbf_prefix_position:\n\t.quad %lld\nbf_prefix_output_length:\n\t.quad %lld\n" ,
+			prefix -> length , prefix -> position , prefix -> output_length ) ;
+	}
+	compiler_emit_bytes ( output , emit , "bf_prefix_cells" , prefix -> cells , prefix -> length ) ;
+	compiler_emit_bytes ( output , emit , "bf_prefix_output" , prefix -> output , prefix -> output_length ) ;
+	if ( emit == EMIT_ASM ) {
+		fputc ( '\n' , output ) ;
+	}
+}
+
+void compiler_emit_c ( FILE * output ) {
+	long long index , depth = 1 , level ;
+	fprintf ( output , "/* Compiled from a Brainfuck program at optimization level %d. */\n\n" , program . options . optimization_level ) ;
+	compiler_emit_runtime ( output ) ;
+	fprintf ( output , "\nconst long long bf_margin = %lld ;\n" , bounds_margin ( & program . code ) ) ;
+	compiler_emit_prefix ( output , EMIT_C ) ;
+	fprintf ( output , "\nuint8_t * bf_run ( struct bf_table * table , uint8_t * p ) {\n" ) ;
+	for ( index = 0 ; index < program . code . length ; index ++ ) {												//Go through the program instructions and write the C statements of each.
+		struct program_instruction * instruction = & program . code . instructions [ index ] ;
+		unsigned value = ( unsigned ) ( uint8_t ) instruction -> argument ;											//The argument as a cell value, since cell arithmetic wraps around at 256.
+		if ( instruction -> operation == OPERATION_LOOP_END ) {
+			depth -- ;
+		}
+		if ( ( instruction -> operation == OPERATION_ADD ) && ( value == 0 ) ) {									//Skip additions which wrap around to nothing.
+			continue ;
+		}
+		for ( level = 0 ; level < depth ; level ++ ) {																//Indent the statement to the depth of its loop.
+			fputc ( '\t' , output ) ;
+		}
+		switch ( instruction -> operation ) {
+			case OPERATION_ADD : fprintf ( output , "p [ %lld ] += %u ;\n" , instruction -> offset , value ) ; break ;
+			case OPERATION_SET : fprintf ( output , "p [ %lld ] = %u ;\n" , instruction -> offset , value ) ; break ;
+			case OPERATION_MULTIPLY :
+				fprintf ( output , "p [ %lld ] += ( uint8_t ) ( p [ %lld ] * %uu ) ;\n" , instruction -> offset + instruction -> distance , instruction -> offset , value ) ;
+				break ;
+			case OPERATION_MOVE :
+				fprintf ( output , "p += %lld ;\n" , instruction -> argument ) ;
+				break ;
+			case OPERATION_SCAN : fprintf ( output , "p = bf_scan ( table , p , %lld ) ;\n" , instruction -> argument ) ; break ;
+			case OPERATION_OUTPUT : fprintf ( output , "bf_output ( p [ %lld ] ) ;\n" , instruction -> offset ) ; break ;
+			case OPERATION_INPUT : fprintf ( output , "p [ %lld ] = ( uint8_t ) bf_input ( ) ;\n" , instruction -> offset ) ; break ;
+			case OPERATION_LOOP_START : fprintf ( output , "while ( p [ 0 ] ) {\n" ) ; depth ++ ; break ;
+			case OPERATION_LOOP_END : fprintf ( output , "}\n" ) ; break ;
+			case OPERATION_GUARD : fprintf ( output , "if ( ( uintptr_t ) p - table -> low >= table -> span ) p = bf_grow ( table , p ) ;\n" ) ; break ;	//Grow the list if the pointer is too close to its ends for the stretch after the guard.
+			default : break ;
+		}
+	}
+	fprintf ( output , "\treturn p ;\n}\n" ) ;
+}
+
+void compiler_emit_asm ( FILE * output ) {
+	long long index , depth = 0 ;
+	long long * loop_starts = ( long long * ) malloc ( ( program . code . length + 1 ) * sizeof ( long long ) ) ;	//Create a stack of the loops started but not yet ended, to name the labels of their jumps.
+	long long margin = bounds_margin ( & program . code ) ;
+	if ( loop_starts == NULL ) {
+		strcpy ( program . file . message , "Not enough memory for the program instructions." ) ;					//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		program . file . status = -5 ;
+		error_procedure ( ) ;
+	}
+	if ( ( margin > INT32_MAX / 2 ) || ( compiler_reach ( ) > INT32_MAX / 2 ) ) {									//Check if a cell is too far from the pointer to be addressed by an instruction.
+		strcpy ( program . file . message , "The program accesses cells too far apart for the assembly output." ) ;	//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		program . file . status = -6 ;
+		error_procedure ( ) ;
+	}
+	fprintf ( output , "# Compiled from a Brainfuck program at optimization level %d.\n" , program . options . optimization_level ) ;
+	fprintf ( output , "# The pointer lives in rbx and the bf_table in r12.\n\n" ) ;
+	fprintf ( output , "\t.section .rodata\n\t.globl bf_margin\n\t.p2align 3\nbf_margin:\n\t.quad %lld\n\n" , margin ) ;
+	compiler_emit_prefix ( output , EMIT_ASM ) ;
+	fprintf ( output , "\t.text\n\t.globl bf_run\n\t.type bf_run, @function\nbf_run:\n" ) ;
+	fprintf ( output , "\tpush %%rbp\n\tpush %%rbx\n\tpush %%r12\n\tmov %%rdi, %%r12\n\tmov %%rsi, %%rbx\n" ) ;
+	for ( index = 0 ; index < program . code . length ; index ++ ) {												//Go through the program instructions and write the assembly of each.
+		struct program_instruction * instruction = & program . code . instructions [ index ] ;
+		unsigned value = ( unsigned ) ( uint8_t ) instruction -> argument ;											//The argument as a cell value, since cell arithmetic wraps around at 256.
+		switch ( instruction -> operation ) {
+			case OPERATION_ADD :
+				if ( value != 0 ) {																					//Skip additions which wrap around to nothing.
+					fprintf ( output , "\taddb $%u, %lld(%%rbx)\n" , value , instruction -> offset ) ;
+				}
+				break ;
+			case OPERATION_SET :
+				fprintf ( output , "\tmovb $%u, %lld(%%rbx)\n" , value , instruction -> offset ) ;
+				break ;
+			case OPERATION_MULTIPLY :
+				if ( value != 0 ) {																					//Skip multiplications which wrap around to nothing.
+					fprintf ( output , "\tmovzbl %lld(%%rbx), %%eax\n" , instruction -> offset ) ;
+					if ( value != 1 ) {																				//Skip the multiplication by 1 of plain copy loops.
+						fprintf ( output , "\timul $%u, %%eax, %%eax\n" , value ) ;
+					}
+					fprintf ( output , "\taddb %%al, %lld(%%rbx)\n" , instruction -> offset + instruction -> distance ) ;
+				}
+				break ;
+			case OPERATION_MOVE :
+				if ( llabs ( instruction -> argument ) <= INT32_MAX ) {
+					fprintf ( output , "\tadd $%lld, %%rbx\n" , instruction -> argument ) ;
+				}
+				else {																								//Load distances too long for an immediate value into a register first.
+					fprintf ( output , "\tmovabs $%lld, %%rax\n\tadd %%rax, %%rbx\n" , instruction -> argument ) ;
+				}
+				break ;
+			case OPERATION_SCAN :
+				fprintf ( output , "\tmov %%r12, %%rdi\n\tmov %%rbx, %%rsi\n\tmov $%lld, %%rdx\n\tcall bf_scan@PLT\n\tmov %%rax, %%rbx\n" , instruction -> argument ) ;
+				break ;
+			case OPERATION_OUTPUT :
+				fprintf ( output , "\tmovzbl %lld(%%rbx), %%edi\n\tcall bf_output@PLT\n" , instruction -> offset ) ;
+				break ;
+			case OPERATION_INPUT :
+				fprintf ( output , "\tcall bf_input@PLT\n\tmov %%al, %lld(%%rbx)\n" , instruction -> offset ) ;
+				break ;
+			case OPERATION_LOOP_START :
+				loop_starts [ depth ++ ] = index ;																	//Remember the loop, to name the labels of its jumps.
+				fprintf ( output , "\tcmpb $0, (%%rbx)\n\tje .Lend_%lld\n.Lbody_%lld:\n" , index , index ) ;
+				break ;
+			case OPERATION_LOOP_END :
+				depth -- ;
+				fprintf ( output , "\tcmpb $0, (%%rbx)\n\tjne .Lbody_%lld\n.Lend_%lld:\n" , loop_starts [ depth ] , loop_starts [ depth ] ) ;
+				break ;
+			case OPERATION_GUARD :																					//Grow the list if the pointer is too close to its ends for the stretch after the guard.
+				fprintf ( output , "\tmov %%rbx, %%rax\n\tsub (%%r12), %%rax\n\tcmp 8(%%r12), %%rax\n\tjb .Lguarded_%lld\n" , index ) ;
+				fprintf ( output , "\tmov %%r12, %%rdi\n\tmov %%rbx, %%rsi\n\tcall bf_grow@PLT\n\tmov %%rax, %%rbx\n.Lguarded_%lld:\n" , index ) ;
+				break ;
+			default : break ;
+		}
+	}
+	fprintf ( output , "\tmov %%rbx, %%rax\n\tpop %%r12\n\tpop %%rbx\n\tpop %%rbp\n\tret\n" ) ;
+	fprintf ( output , "\t.size bf_run, .-bf_run\n\n\t.section .note.GNU-stack,\"\",@progbits\n" ) ;				//Mark the stack as not executable.
+	free ( loop_starts ) ;
+}
+
+void compiler_write ( char * file , int emit ) {
+	FILE * output = stdout ;
+	if ( file != NULL ) {																							//Check if a compiled output file was specified.
+		output = fopen ( file , "w" ) ;
+		if ( output == NULL ) {																						//Check if the file has not been opened.
+			strcpy ( program . file . message , "Compiled output file couldn't be opened." ) ;						//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+			program . file . status = -7 ;
+			error_procedure ( ) ;
+		}
+	}
+	switch ( emit ) {																								//Write the chosen output.
+		case EMIT_C : compiler_emit_c ( output ) ; break ;
+		case EMIT_ASM : compiler_emit_asm ( output ) ; break ;
+		case EMIT_RUNTIME : compiler_emit_runtime ( output ) ; break ;
+		default : break ;
+	}
+	if ( output != stdout ) {
+		fclose ( output ) ;
+	}
+}
+
+void compiler_build ( char * executable ) {
+	char source [ COMPILER_PATH_SIZE ] , runtime [ COMPILER_PATH_SIZE ] , compiler [ COMPILER_PATH_SIZE ] ;
+	char * arguments [ COMPILER_ARGUMENTS_MAXIMUM ] ;
+	const char * cc = getenv ( "CC" ) ;																				//Use the C compiler given in the environment, if any.
+	int count = 0 , status = -1 ;
+	char * word ;
+	pid_t child ;
+	if ( ( cc == NULL ) || ( cc [ 0 ] == '\0' ) ) {
+		cc = "cc" ;
+	}
+	if ( snprintf ( compiler , sizeof ( compiler ) , "%s" , cc ) >= ( int ) sizeof ( compiler ) ) {					//Check if the C compiler given in the environment does not fit.
+		strcpy ( program . file . message , "The system C compiler command is too long." ) ;						//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		program . file . status = -8 ;
+		error_procedure ( ) ;
+	}
+	if ( ( snprintf ( source , sizeof ( source ) , "%s.bfc.%s" , executable , ( compiler_emit == EMIT_ASM ) ? "s" : "c" ) >= ( int ) sizeof ( source ) )	//Name the temporary files after the executable.
+		|| ( snprintf ( runtime , sizeof ( runtime ) , "%s.bfc.runtime.c" , executable ) >= ( int ) sizeof ( runtime ) ) ) {
+		strcpy ( program . file . message , "Compiled output file name is too long." ) ;							//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		program . file . status = -7 ;
+		error_procedure ( ) ;
+	}
+	for ( word = strtok ( compiler , " \t" ) ; ( word != NULL ) && ( count < COMPILER_ARGUMENTS_MAXIMUM - 6 ) ; word = strtok ( NULL , " \t" ) ) {	//Split the C compiler into its words, so that it may carry options of its own.
+		arguments [ count ++ ] = word ;
+	}
+	if ( ( word != NULL ) || ( count == 0 ) ) {																		//Check if the C compiler has too many words, or none at all.
+		strcpy ( program . file . message , "The system C compiler command is not valid." ) ;						//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		program . file . status = -8 ;
+		error_procedure ( ) ;
+	}
+	arguments [ count ++ ] = "-O2" ;																				//Pass every file name as an argument of its own, so that no shell ever reads it.
+	arguments [ count ++ ] = "-o" ;
+	arguments [ count ++ ] = executable ;
+	arguments [ count ++ ] = source ;
+	if ( compiler_emit == EMIT_ASM ) {																				//Check if the program is compiled to assembly, which is linked with the runtime.
+		compiler_write ( source , EMIT_ASM ) ;
+		compiler_write ( runtime , EMIT_RUNTIME ) ;
+		arguments [ count ++ ] = runtime ;
+	}
+	else {
+		compiler_write ( source , EMIT_C ) ;
+	}
+	arguments [ count ] = NULL ;
+	fflush ( stdout ) ;																								//Write out anything pending, so that the child does not write it again.
+	child = fork ( ) ;
+	if ( child == 0 ) {																								//Run the system C compiler in the child.
+		execvp ( arguments [ 0 ] , arguments ) ;
+		_exit ( 127 ) ;
+	}
+	if ( ( child < 0 ) || ( waitpid ( child , & status , 0 ) != child ) ) {
+		status = -1 ;
+	}
+	remove ( source ) ;																								//Remove the temporary files.
+	if ( compiler_emit == EMIT_ASM ) {
+		remove ( runtime ) ;
+	}
+	if ( ( status == -1 ) || ( ! WIFEXITED ( status ) ) || ( WEXITSTATUS ( status ) != 0 ) ) {						//Check if the system C compiler could not be run, or failed.
+		strcpy ( program . file . message , "The system C compiler could not build the executable." ) ;				//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		program . file . status = -8 ;
+		error_procedure ( ) ;
+	}
+}
+
+void compiler_clean ( ) {
+	free ( program . code . instructions ) ;																		//Free the program instructions array.
+	program . code . instructions = NULL ;
+	prefix_clean ( & program . prefix ) ;																			//Free the state left by the prefix.
+	program . code . length = 0 ;
+	program . file . status = 0 ;																					//Set the status to 0 ( meaning completed ).
+	strcpy ( program . file . message , "Completed" ) ;																//Set the status message to "Completed".
+}
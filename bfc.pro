@@ -0,0 +1,3 @@
+TARGET = bfc
+SOURCES += bfc.c program.c prefix.c bounds.c
+QMAKE_CFLAGS += -Wall -Wextra -Wshadow -pedantic -Werror -std=c99
\ No newline at end of file
@@ -0,0 +1,177 @@
+/**
+ * Brainfuck Bounds Analysis
+ *
+ * Finds which cells each stretch of the program can reach from where the pointer was when the stretch began, so that the engines check the program list bounds once for the stretch, at a guard instruction placed before it, instead of at every instruction.
+ * A loop which ends every iteration with the pointer where it started reaches the same cells however often it runs, so it is checked once before it starts, along with the instructions around it.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# include <limits.h>
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include "struct.h"
+# include "bounds.h"
+
+/**
+ * The reach function that widens the cells reached by a stretch to take in the given cell.
+ */
+void bounds_reach ( long long * low , long long * high , long long cell ) {
+	* low = ( cell < * low ) ? cell : * low ;
+	* high = ( cell > * high ) ? cell : * high ;
+}
+
+/**
+ * The step function that adds the cells reached by an instruction to those of its stretch, and moves the pointer of the stretch along with it.
+ */
+void bounds_step ( const struct program_instruction * instruction , long long * pointer , long long * low , long long * high ) {
+	switch ( instruction -> operation ) {
+		case OPERATION_MOVE : * pointer += instruction -> argument ; break ;
+		case OPERATION_MULTIPLY : bounds_reach ( low , high , * pointer + instruction -> offset + instruction -> distance ) ;	//Take in the cell added to, as well as the cell read.
+			bounds_reach ( low , high , * pointer + instruction -> offset ) ; break ;
+		case OPERATION_ADD :
+		case OPERATION_SET :
+		case OPERATION_OUTPUT :
+		case OPERATION_INPUT : bounds_reach ( low , high , * pointer + instruction -> offset ) ; break ;
+		default : bounds_reach ( low , high , * pointer ) ; break ;													//The loops and scans read the current cell.
+	}
+}
+
+/**
+ * The balance function that finds the loops which end every iteration with the pointer where it started, which only hold such loops and no scans.
+ * Returns an array marking the start of every such loop, or NULL if there is not enough memory.
+ */
+uint8_t * bounds_balanced ( const struct program_code * code ) {
+	uint8_t * balanced = ( uint8_t * ) malloc ( ( code -> length + 1 ) * sizeof ( uint8_t ) ) ;
+	long long * starts = ( long long * ) malloc ( ( code -> length + 1 ) * sizeof ( long long ) ) ;					//A stack of the loops started but not yet ended.
+	long long * moved = ( long long * ) malloc ( ( code -> length + 1 ) * sizeof ( long long ) ) ;					//The total movement of the pointer within the body of every loop, outside the loops within it.
+	long long index , depth = 0 ;
+	if ( ( balanced == NULL ) || ( starts == NULL ) || ( moved == NULL ) ) {
+		free ( balanced ) ;
+		free ( starts ) ;
+		free ( moved ) ;
+		return NULL ;
+	}
+	for ( index = 0 ; index < code -> length ; index ++ ) {
+		const struct program_instruction * instruction = & code -> instructions [ index ] ;
+		balanced [ index ] = 0 ;
+		switch ( instruction -> operation ) {
+			case OPERATION_LOOP_START :
+				starts [ depth ++ ] = index ;
+				balanced [ index ] = 1 ;																			//Take the loop as balanced until something in it shows otherwise.
+				moved [ index ] = 0 ;
+				break ;
+			case OPERATION_LOOP_END :
+				if ( depth == 0 ) {
+					break ;
+				}
+				depth -- ;
+				balanced [ starts [ depth ] ] = balanced [ starts [ depth ] ] && ( moved [ starts [ depth ] ] == 0 ) ;
+				if ( ( depth > 0 ) && ( ! balanced [ starts [ depth ] ] ) ) {										//A loop holding a loop that is not balanced is not balanced either.
+					balanced [ starts [ depth - 1 ] ] = 0 ;
+				}
+				break ;
+			case OPERATION_MOVE :
+				if ( depth > 0 ) {
+					moved [ starts [ depth - 1 ] ] += instruction -> argument ;
+				}
+				break ;
+			case OPERATION_SCAN :
+				if ( depth > 0 ) {																					//A scan moves the pointer by an amount not known ahead.
+					balanced [ starts [ depth - 1 ] ] = 0 ;
+				}
+				break ;
+			default : break ;
+		}
+	}
+	free ( starts ) ;
+	free ( moved ) ;
+	return balanced ;
+}
+
+int bounds_analyze ( struct program_code * code ) {
+	uint8_t * balanced = bounds_balanced ( code ) ;																	//Without enough memory, every loop is taken as not balanced, which only keeps more checks.
+	struct program_instruction * instructions = ( struct program_instruction * ) malloc ( ( 2 * code -> length + 1 ) * sizeof ( struct program_instruction ) ) ;	//Room for a guard before every instruction, which is the most there can be.
+	struct program_instruction * shrunk ;
+	long long * moved = ( long long * ) malloc ( ( code -> length + 1 ) * sizeof ( long long ) ) ;					//The index every instruction is moved to, to move the jumps of the loops along with them.
+	long long index , leader = 0 , length = 0 ;
+	if ( ( instructions == NULL ) || ( moved == NULL ) ) {
+		free ( balanced ) ;
+		free ( instructions ) ;
+		free ( moved ) ;
+		return 0 ;																									//Return 0 ( false ) as there is not enough memory.
+	}
+	code -> checks = 0 ;
+	code -> guards = 0 ;
+	for ( index = 0 ; index < code -> length ; index ++ ) {															//Count the checks every instruction which reaches a cell or moves the pointer would make on its own.
+		switch ( code -> instructions [ index ] . operation ) {
+			case OPERATION_MULTIPLY : code -> checks += 2 ; break ;
+			case OPERATION_ADD :
+			case OPERATION_SET :
+			case OPERATION_OUTPUT :
+			case OPERATION_INPUT :
+			case OPERATION_MOVE : code -> checks ++ ; break ;
+			default : break ;
+		}
+	}
+	while ( leader < code -> length ) {																				//Go through the stretches, each starting where the last one ended.
+		long long pointer = 0 , low = LLONG_MAX , high = LLONG_MIN ;
+		for ( index = leader ; index < code -> length ; index ++ ) {
+			const struct program_instruction * instruction = & code -> instructions [ index ] ;
+			if ( ( instruction -> operation == OPERATION_LOOP_START ) && ( balanced != NULL ) && balanced [ index ] ) {	//Take a balanced loop into the stretch whole, since it reaches the same cells on every iteration.
+				long long end = instruction -> jump ;
+				for ( ; index <= end ; index ++ ) {
+					bounds_step ( & code -> instructions [ index ] , & pointer , & low , & high ) ;
+				}
+				index = end ;
+				continue ;
+			}
+			bounds_step ( instruction , & pointer , & low , & high ) ;
+			if ( ( instruction -> operation == OPERATION_LOOP_START ) || ( instruction -> operation == OPERATION_LOOP_END ) || ( instruction -> operation == OPERATION_SCAN ) ) {
+				index ++ ;																							//End the stretch, since the pointer may be anywhere once it is jumped to or scanned from.
+				break ;
+			}
+		}
+		if ( low <= high ) {																						//Check the cells the stretch reaches at its start, unless it reaches none.
+			struct program_instruction * guard = & instructions [ length ++ ] ;
+			memset ( guard , 0 , sizeof ( struct program_instruction ) ) ;
+			guard -> operation = OPERATION_GUARD ;
+			guard -> position = code -> instructions [ leader ] . position ;
+			guard -> low = low ;
+			guard -> high = high ;
+			code -> guards ++ ;
+		}
+		for ( ; leader < index ; leader ++ ) {																		//Copy the instructions of the stretch after its guard.
+			moved [ leader ] = length ;
+			instructions [ length ++ ] = code -> instructions [ leader ] ;
+		}
+	}
+	for ( index = 0 ; index < length ; index ++ ) {																	//Move the jumps of the loops to where the instructions they jump to were moved.
+		if ( ( instructions [ index ] . operation == OPERATION_LOOP_START ) || ( instructions [ index ] . operation == OPERATION_LOOP_END ) ) {
+			instructions [ index ] . jump = moved [ instructions [ index ] . jump ] ;
+		}
+	}
+	shrunk = ( struct program_instruction * ) realloc ( instructions , ( length + 1 ) * sizeof ( struct program_instruction ) ) ;	//Give back the room not taken by guards, keeping the larger array if it cannot be shrunk.
+	free ( code -> instructions ) ;
+	code -> instructions = ( shrunk != NULL ) ? shrunk : instructions ;
+	code -> length = length ;
+	free ( balanced ) ;
+	free ( moved ) ;
+	return 1 ;																										//Return 1 ( true ) as the guards were placed.
+}
+
+long long bounds_margin ( const struct program_code * code ) {
+	long long index , margin = 0 ;
+	for ( index = 0 ; index < code -> length ; index ++ ) {
+		const struct program_instruction * instruction = & code -> instructions [ index ] ;
+		if ( instruction -> operation == OPERATION_GUARD ) {
+			margin = ( - instruction -> low > margin ) ? - instruction -> low : margin ;
+			margin = ( instruction -> high > margin ) ? instruction -> high : margin ;
+		}
+	}
+	return margin ;
+}
@@ -0,0 +1,20 @@
+# ifndef BRAINF_BOUNDS_FILE
+	# define BRAINF_BOUNDS_FILE 0
+
+	# include "struct.h"
+
+	/**
+	 * The analysis function that finds the cells every stretch of the program instructions can reach, and places a single guard instruction checking the program list bounds at the start of each stretch instead of a check at every instruction.
+	 * A stretch runs until the pointer may move by an amount not known ahead, at a scan or a loop that does not end where it started, while loops that do are taken into the stretch around them whole.
+	 * Sets the number of checks kept and removed in the program instructions, and moves the jumps of the loops past the guards.
+	 * Returns 1 ( true ) if the guards were placed, or 0 ( false ) if there is not enough memory, leaving the instructions as they were.
+	 */
+	int bounds_analyze ( struct program_code * ) ;
+
+	/**
+	 * The margin function that finds the farthest any guard of the program instructions reaches from the pointer, for the engines which keep that many cells on either side of the pointer.
+	 * Returns the margin.
+	 */
+	long long bounds_margin ( const struct program_code * ) ;
+
+#endif
@@ -0,0 +1,30 @@
+/**
+ * Brainfuck Command Line Client
+ * 
+ * Holds the details of the program run by the command line interpreter, and handles its errors by showing them and exiting.
+ * Only the library header is used, as for any other program embedding the library.
+ * 
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include "libbf.h"
+# include "client.h"
+
+/**
+ * The client variable containing the details of the program currently being interpreted from the command line.
+ */
+struct client_details client ;
+
+void error_procedure ( ) {
+	fprintf ( client . progout , "\n\n------------------" ) ;
+	fprintf ( client . progout , "\nERROR : %s" , client . message ) ;
+	fprintf ( client . progout , "\nLOCATION : Byte %lld" , client . position ) ;
+	fprintf ( client . progout , "\n------------------\n\n" ) ;
+	exit ( client . status ) ;
+}
@@ -0,0 +1,31 @@
+# ifndef BRAINF_CLIENT_FILE
+	# define BRAINF_CLIENT_FILE 0
+
+	# include <stdio.h>
+	# include "libbf.h"
+
+	/**
+	 * The details of the program currently being run from the command line, kept by the interpreter alongside the library context.
+	 */
+	struct client_details {
+		FILE * source ;															//The program source file.
+		FILE * progin ;															//The program input file.
+		FILE * progout ;														//The program output file, which errors are shown on as well.
+		int profile ;															//Whether the run is profiled.
+		char * profile_dump ;													//The file the profile counters are dumped to, or NULL for none.
+		int status ;															//The current status of the program, or the status of the error hit.
+		char message [ 65536 ] ;												//A message about the current status of the program, or the error hit.
+		long long position ;													//The byte of the program source the error was found at.
+	} ;
+
+	/**
+	 * The client variable containing the details of the program currently being interpreted from the command line.
+	 */
+	extern struct client_details client ;
+
+	/**
+	 * The error function to handle any errors encountered, which shows the error and exits.
+	 */
+	void error_procedure ( ) ;
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * Brainfuck Engine
+ *
+ * The interpreter engine, written once and built by the library for every cell width and end of input policy, so that the running program never has to check either.
+ * Included once for every combination, with ENGINE_NAME set to the name of the execution function, ENGINE_CELL to the type of a cell and ENGINE_EOF to the end of input policy.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+/**
+ * The cell macro that reaches the program list cell at the given offset from the program stack pointer, as the type of a cell.
+ */
+# define ENGINE_AT( offset ) ( ( ( ENGINE_CELL * ) details -> list . cells ) [ details -> list . position + ( offset ) ] )
+
+/**
+ * The execution function that performs the interpretation and execution of the program, for a single cell width and end of input policy.
+ */
+void ENGINE_NAME ( struct program_details * details ) {
+	struct program_code * code = & details -> code ;
+	long long found ;
+	int value ;
+	for ( code -> counter = 0 ; code -> counter < code -> length ; code -> counter ++ ) {							//Go through the program instructions one at a time.
+		struct program_instruction * instruction = & code -> instructions [ code -> counter ] ;
+		dispatch :
+		switch ( instruction -> operation ) {																		//Decide the action to perform depending on the instruction.
+			case OPERATION_MOVE : details -> list . position += instruction -> argument ; break ;					//Move the program list pointer. The list was grown for where it moves to at the start of the stretch.
+			case OPERATION_ADD : ENGINE_AT ( instruction -> offset ) += ( ENGINE_CELL ) instruction -> argument ; break ;	//Add to the cell, wrapping around like repeated increments would.
+			case OPERATION_SET : ENGINE_AT ( instruction -> offset ) = ( ENGINE_CELL ) instruction -> argument ; break ;
+			case OPERATION_MULTIPLY :																				//Add the cell times the factor to the cell at the distance from it, multiplying without a sign so the product wraps around.
+				ENGINE_AT ( instruction -> offset + instruction -> distance ) += ( ENGINE_CELL ) ( ( uint32_t ) ENGINE_AT ( instruction -> offset ) * ( uint32_t ) instruction -> argument ) ;
+				break ;
+			case OPERATION_OUTPUT :																					//Output the lowest byte of the cell.
+				io_output ( & details -> io , ( uint8_t ) ENGINE_AT ( instruction -> offset ) ) ;
+				if ( details -> io . failed ) {
+					library_error ( details , BF_ERROR_OUTPUT , "The program output could not be written." ) ;
+				}
+				break ;
+			case OPERATION_INPUT :
+				value = io_input ( & details -> io ) ;
+				if ( value != EOF ) {
+					ENGINE_AT ( instruction -> offset ) = ( ENGINE_CELL ) value ;
+				}
+				else if ( details -> io . input_failed ) {															//Stop the program if the input could not be read, rather than take it as ended.
+					library_error ( details , BF_ERROR_INPUT , "The program input could not be read." ) ;
+				}
+				else if ( ENGINE_EOF == EOF_ZERO ) {																//The policy is fixed for the engine, so only one of these is built into it.
+					ENGINE_AT ( instruction -> offset ) = 0 ;
+				}
+				else if ( ENGINE_EOF == EOF_MINUS_ONE ) {
+					ENGINE_AT ( instruction -> offset ) = ( ENGINE_CELL ) -1 ;
+				}
+				break ;
+			case OPERATION_SCAN :																					//Move the program list pointer to the next cell holding 0.
+				if ( sizeof ( ENGINE_CELL ) == 1 ) {																//The width is fixed for the engine, so only one of these is built into it.
+					scan_byte_program_list ( details , instruction -> argument ) ;
+					break ;
+				}
+				for ( found = details -> list . position ; ( found >= 0 ) && ( found < details -> list . size ) && ( ( ( ENGINE_CELL * ) details -> list . cells ) [ found ] != 0 ) ; found += instruction -> argument ) ;	//Scan the wider cells one at a time, reading them as the type of a cell.
+				details -> list . position = found ;
+				program_list_cell ( details , 0 ) ;																	//Grow the list if the cell found is outside it.
+				break ;
+			case OPERATION_LOOP_START : if ( ENGINE_AT ( 0 ) == 0 ) code -> counter = instruction -> jump ; break ;	//Skip to the matching end of the loop if the cell holds 0.
+			case OPERATION_LOOP_END : if ( ENGINE_AT ( 0 ) != 0 ) code -> counter = instruction -> jump ; break ;	//Go back to the start of the loop if the cell does not hold 0.
+			case OPERATION_GUARD :																					//Check the list bounds once for the stretch after the guard, instead of at every instruction in it.
+				reserve_program_list ( details , instruction -> low , instruction -> high ) ;
+				code -> counter ++ ;																				//Go straight on to the first instruction of the stretch, which always follows the guard, without going around the loop.
+				instruction ++ ;
+				goto dispatch ;
+			default : break ;
+		}
+	}
+}
+
+# undef ENGINE_AT
+# undef ENGINE_NAME
+# undef ENGINE_CELL
+# undef ENGINE_EOF
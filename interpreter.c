@@ -1,7 +1,7 @@
 /**
  * Brainfuck Interpreter
  * 
- * Takes a single input file and runs the program in the command line.
+ * Takes a single input file and runs the program in the command line, through the library.
  * 
  * @author Sabarna Chakravarty
  * @license MIT License
@@ -13,73 +13,66 @@
 # include <stdlib.h>
 # include <string.h>
 # include <time.h>
-# include "struct.h"
+# include "libbf.h"
+# include "client.h"
+# include "batch.h"
 
 /**
- * The program variable containing all the needed details of the program currently being interpreted.
+ * The library context the program is compiled and run in.
  */
-struct program_details program ;
+struct bf_context * interpreter = NULL ;
 
 /**
- * The error function to handle any errors encountered.
+ * The program compiled by the library.
  */
-void error_procedure ( ) {
-	fprintf ( program . progout , "\n\n------------------" ) ;
-	fprintf ( program . progout , "\nERROR : %s" , program . file . message ) ;
-	fprintf ( program . progout , "\nLOCATION : Byte %llu" , program . file . pointer . position ) ;
-	fprintf ( program . progout , "\n------------------\n\n" ) ;
-	exit ( program . file . status ) ;
-}
+struct bf_program * compiled = NULL ;
 
 /**
- * The initializer function that sets up the program variable.
+ * The program input file mapped into memory, if it is a regular file.
  */
-void interpreter_init ( char * , char * , char * ) ;
+const uint8_t * interpreter_input = NULL ;
+long long interpreter_input_length = 0 ;
 
 /**
- * The incremental function that increments the program stack pointer.
+ * The manifest or directory of program input files to run the program over, or NULL to run it once.
  */
-void increment_program_list_pointer ( ) ;
+char * interpreter_batch = NULL ;
 
 /**
- * The decremental function that decrements the program stack pointer.
+ * The number of threads the batch is run with, or 0 for one for every processor.
  */
-void decrement_program_list_pointer ( ) ;
+int interpreter_jobs = 0 ;
 
 /**
- * The incremental function that increments the program stack pointer value.
+ * The option function that reads an interpreter option given on the command line.
  */
-void increment_program_list_pointer_value ( ) ;
+int interpreter_options ( char * ) ;
 
 /**
- * The decremental function that decrements the program stack pointer value.
+ * The initializer function that sets up the program variable.
  */
-void decrement_program_list_pointer_value ( ) ;
+void interpreter_init ( char * , char * , char * ) ;
 
 /**
- * The output function that shows the output the program stack pointer value.
+ * The batch function that compiles the program once and runs it over every program input file of the batch.
+ * Returns 0 if every run succeeded, or the status of the first run that failed.
  */
-void output_program_list_pointer_value ( ) ;
+int interpreter_batch_run ( char * , char * ) ;
 
 /**
- * The input function that takes input for the program stack pointer value.
+ * The compiler function that loads the program source file and compiles it with the library.
  */
-void input_program_list_pointer_value ( ) ;
+void interpreter_compile ( ) ;
 
 /**
- * The execution function that performs the interpretation and execution of the program.
+ * The execution function that runs the compiled program with the library, on the program input and output files.
  */
 void interpreter_exec ( ) ;
 
 /**
- * The cleanup function that deinitializes the program list.
+ * The error function that takes the error of the library context, and handles it with the error procedure.
  */
-void clean_program_list ( ) ;
-
-/**
- * The cleanup function that deinitializes the loop list.
- */
-void clean_loop_stack ( ) ;
+void interpreter_error ( int ) ;
 
 /**
  * The cleanup function that deinitializes everything in the program variable.
@@ -90,247 +83,248 @@ void interpreter_clean ( ) ;
  * The main function that starts the interpreter.
  */
 int main ( int argc , char * argv [ ] ) {
-	if ( ( argc < 2 ) || ( argc > 5 ) ) {																			//Check if parameters have been provided for interpretation and execution of a program.
-		printf ( "Usage: %s <source file> [<program input file> [<program output file> [time]]]"
-			, argv [ 0 ] ) ;																						//If an invalid number of arguments have been provided, the correct usage is shown.
+	char * arguments [ 5 ] ;																						//The arguments given on the command line which are not options.
+	int argument_count = 0 , index ;
+	client . progout = stdout ;																					//Show any errors on the standard output until the program output file is opened.
+	client . profile = 0 ;
+	client . profile_dump = NULL ;
+	interpreter = bf_context_create ( ) ;																			//Create the library context, with the options set to their defaults.
+	if ( interpreter == NULL ) {
+		strcpy ( client . message , "Not enough memory for the interpreter." ) ;							//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		client . status = -5 ;
+		error_procedure ( ) ;
+	}
+	for ( index = 0 ; index < argc ; index ++ ) {																	//Go through the command line, separating the options from the arguments.
+		if ( ( index > 0 ) && ( ! strncmp ( argv [ index ] , "--" , 2 ) ) ) {										//Check if the argument is an option.
+			if ( ! interpreter_options ( argv [ index ] ) ) {														//Check if the option is invalid.
+				argument_count = 0 ;																				//Forget the arguments so the correct usage is shown.
+				break ;
+			}
+		}
+		else if ( argument_count < 5 ) {
+			arguments [ argument_count ++ ] = argv [ index ] ;
+		}
+		else {
+			argument_count ++ ;																						//Count the extra argument so the correct usage is shown.
+		}
+	}
+	if ( ( argument_count < 2 ) || ( argument_count > ( ( interpreter_batch != NULL ) ? 3 : 5 ) ) || ( ( interpreter_jobs > 0 ) && ( interpreter_batch == NULL ) ) ) {	//Check if parameters have been provided for interpretation and execution of a program, and the number of threads only along with a batch.
+		printf ( "Usage: %s [--optimize=<level>] [--engine=<interpreter|jit>] [--flush=<auto|line|full>] [--profile[=<dump file>]] [--prefix=<steps>] [--cell=<8|16|32>] [--eof=<unchanged|0|-1>] <source file> [<program output file> [<program input file> [time]]]"
+			"\n       %s [--optimize=<level>] [--engine=<interpreter|jit>] [--prefix=<steps>] [--cell=<8|16|32>] [--eof=<unchanged|0|-1>] --batch=<input manifest or directory> [--jobs=<threads>] <source file> [<output directory or file>]"
+			, argv [ 0 ] , argv [ 0 ] ) ;																			//If an invalid number of arguments have been provided, the correct usage is shown.
 		getchar ( ) ;																								//Take any character input ( this is blocking so the program is paused ).
 		return -1 ;																									//Terminate the interpreter since nothing else can be done.
 	}
+	if ( interpreter_batch != NULL ) {																				//Check if the program is to be run over a batch of program input files instead of once.
+		return interpreter_batch_run ( arguments [ 1 ] , ( ( argument_count >= 3 ) && strcmp ( arguments [ 2 ] , "stdout" ) ) ? arguments [ 2 ] : NULL ) ;
+	}
 	char input [ 65536 ] , output [ 65536 ] ;																		//Two character pointers which will help determine the input and outputs of the program on initialization.
-	if ( ( argc >= 3 ) && ( strcmp ( argv [ 2 ] , "stdout" ) ) ) {													//Check if a second argument was provided which is supposed to be the file into which program output is written.
-		strcpy ( output , argv [ 2 ] ) ;																			//Set the file as the program output since it was passed as a parameter.
+	if ( ( argument_count >= 3 ) && ( strcmp ( arguments [ 2 ] , "stdout" ) ) ) {									//Check if a second argument was provided which is supposed to be the file into which program output is written.
+		strcpy ( output , arguments [ 2 ] ) ;																		//Set the file as the program output since it was passed as a parameter.
 	}
 	else {
 		output [ 0 ] = '\0' ;																						//Set the file as the program output which means to just use the standard output.
 	}
-	if ( ( argc >= 4 ) && ( strcmp ( argv [ 3 ] , "stdin" ) ) ) {													//Check if a third argument was provided which is supposed to be the file from which program input is read.
-		strcpy ( input , argv [ 3 ] ) ;																				//Set the file as the program input since it was passed as a parameter.
+	if ( ( argument_count >= 4 ) && ( strcmp ( arguments [ 3 ] , "stdin" ) ) ) {									//Check if a third argument was provided which is supposed to be the file from which program input is read.
+		strcpy ( input , arguments [ 3 ] ) ;																		//Set the file as the program input since it was passed as a parameter.
 	}
 	else {
 		input [ 0 ] = '\0' ;																						//Set the file as the program input which means to just use the standard input.
 	}
 	
-	interpreter_init ( argv [ 1 ] , output , input ) ;																//Initialize the interpreter.
+	interpreter_init ( arguments [ 1 ] , output , input ) ;															//Initialize the interpreter.
+	interpreter_compile ( ) ;																						//Load the program source file and compile it with the library.
 
 	clock_t start = clock ( ) ;																						//Get the start clock just before execution.
 	interpreter_exec ( ) ;																							//Execute the interpreter.
-	if ( ( argc >= 5 ) && ( ! strcmp ( argv [ 4 ] , "time" ) ) ) {													//Check if a fourth argument was provided which is supposed to tell the interpreter to show the final execution time.
+	if ( ( argument_count >= 5 ) && ( ! strcmp ( arguments [ 4 ] , "time" ) ) ) {									//Check if a fourth argument was provided which is supposed to tell the interpreter to show the final execution time.
 		double cpu_time_used = ( ( double ) ( clock ( ) - start ) ) / CLOCKS_PER_SEC ;								//Calculate the total CPU time used for execution.
-		fprintf ( program . progout , "\n\n------------------" ) ;
-		fprintf ( program . progout , "\nCPU time used : %f" , cpu_time_used ) ;									//Output the total CPU time used.
-		fprintf ( program . progout , "\n------------------\n\n" ) ;
+		struct bf_stats stats ;
+		bf_context_stats ( interpreter , compiled , & stats ) ;														//Get the details of the run from the library.
+		fprintf ( client . progout , "\n\n------------------" ) ;
+		fprintf ( client . progout , "\nCPU time used : %f" , cpu_time_used ) ;									//Output the total CPU time used.
+		if ( stats . jit ) {																						//Check if the JIT engine was used, and output its compilation details.
+			fprintf ( client . progout , "\nJIT compile time : %f" , stats . compile_time ) ;
+			fprintf ( client . progout , "\nJIT instructions : %lld" , stats . instructions ) ;
+			fprintf ( client . progout , "\nJIT code size : %lld bytes" , stats . machine_code_size ) ;
+		}
+		else if ( client . profile ) {																	//Output how many instructions were executed, which only the profiled runs count.
+			fprintf ( client . progout , "\nInstructions executed : %lld" , stats . executed ) ;
+		}
+		if ( stats . prefix_executed != 0 ) {																		//Output how many instructions were run once when the program was compiled, instead of on every run.
+			fprintf ( client . progout , "\nPrefix instructions executed : %lld" , stats . prefix_executed ) ;
+		}
+		fprintf ( client . progout , "\nBounds checks removed : %lld of %lld" , stats . bounds_checks - stats . bounds_guards , stats . bounds_checks ) ;	//Output how many list bounds checks the bounds analysis took out of the instructions, keeping one at the start of every stretch.
+		fprintf ( client . progout , "\nOutput bytes : %lld" , stats . output_bytes ) ;							//Output how many bytes went through the program input and output, and how many writes and reads it took.
+		fprintf ( client . progout , "\nOutput writes : %lld" , stats . output_writes ) ;
+		fprintf ( client . progout , "\nInput bytes : %lld" , stats . input_bytes ) ;
+		if ( stats . input_reads < 0 ) {
+			fprintf ( client . progout , "\nInput reads : none ( mapped )" ) ;
+		}
+		else {
+			fprintf ( client . progout , "\nInput reads : %lld" , stats . input_reads ) ;
+		}
+		fprintf ( client . progout , "\n------------------\n\n" ) ;
+	}
+	if ( client . profile ) {																			//Check if the program was profiled, and report where its time went.
+		bf_profile_report ( interpreter , compiled , client . progout ) ;
+		if ( ( client . profile_dump != NULL ) && ( bf_profile_dump ( interpreter , compiled , client . profile_dump ) != BF_OK ) ) {
+			strcpy ( client . message , "Profile dump file could not be written." ) ;						//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+			client . status = -7 ;
+			error_procedure ( ) ;
+		}
 	}
 
 	interpreter_clean ( ) ;																							//Clean up after the interpreter.
 	
-	return program . file . status ;																				//Return the final program status.
+	return client . status ;																				//Return the final program status.
+}
+
+int interpreter_options ( char * option ) {
+	if ( ! strcmp ( option , "--profile" ) ) {																		//Check if the option profiles the program.
+		client . profile = 1 ;
+	}
+	else if ( ( ! strncmp ( option , "--profile=" , 10 ) ) && ( option [ 10 ] != '\0' ) ) {							//Check if the option profiles the program and dumps the counters to a file.
+		client . profile = 1 ;
+		client . profile_dump = option + 10 ;
+		option = "--profile" ;																						//Profile the program in the library, and keep the dump file to write once it has run.
+	}
+	else if ( ( ! strncmp ( option , "--batch=" , 8 ) ) && ( option [ 8 ] != '\0' ) ) {								//Check if the option runs the program over a batch of program input files.
+		interpreter_batch = option + 8 ;
+		return 1 ;
+	}
+	else if ( ! strncmp ( option , "--jobs=" , 7 ) ) {																//Check if the option sets the number of threads of the batch.
+		interpreter_jobs = atoi ( option + 7 ) ;
+		return interpreter_jobs > 0 ;
+	}
+	return bf_context_option ( interpreter , option ) == BF_OK ;													//Return 1 ( true ) if the library knows the option.
 }
 
 void interpreter_init ( char * program_file , char * output , char * input ) {
-	program . file . source = fopen ( program_file , "r" ) ;														//Open the program source file.
-	if ( program . file . source == NULL ) {																				//Check if the file has not been opened.
-		strcpy ( program . file . message , "Source file doesn't exist." ) ;										//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
-		program . file . status = -2 ;
+	client . source = fopen ( program_file , "rb" ) ;														//Open the program source file.
+	if ( client . source == NULL ) {																		//Check if the file has not been opened.
+		strcpy ( client . message , "Source file doesn't exist." ) ;										//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		client . status = -2 ;
 		error_procedure ( ) ;
 	}
-	program . file . pointer . position = 0 ;																		//Set the position of the input pointer to 0 ( the start ).
-	program . list . list_position = ( struct program_list_node * ) 
-		malloc ( sizeof ( struct program_list_node ) ) ;															//Create a program list node for the program to operate on. More nodes will be added as required.
-	program . list . list_position -> value = 0 ;																	//Set the value of the current program list node to 0.
-	program . list . list_position -> next_node = NULL ;															//Set the next node after the current list node to NULL.
-	program . list . list_position -> previous_node = NULL ;														//Set the previous node after the current list node to NULL.
-	program . list . loop_top = NULL ;																				//Set the loop stack to empty ( since there is no loop running at the start ).
+	client . position = 0 ;																		//Set the position of the input pointer to 0 ( the start ).
 	if ( output [ 0 ] != '\0' ) {																					//Check if a program output file was specified.
-		program . progout = fopen ( output , "wb" ) ;																//Set the program output as the given file.
+		client . progout = fopen ( output , "wb" ) ;																//Set the program output as the given file.
+		if ( client . progout == NULL ) {																			//Check if the file has not been opened.
+			client . progout = stdout ;																			//Show the error on the standard output, since there is no program output file.
+			strcpy ( client . message , "Program output file couldn't be opened." ) ;						//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+			client . status = -7 ;
+			error_procedure ( ) ;
+		}
 	}
 	else {
-		program . progout = stdout ;																				//Set the program output as the standard output.
+		client . progout = stdout ;																				//Set the program output as the standard output.
 	}
 	if ( input [ 0 ] != '\0' ) {																					//Check if a program input file was specified.
-		program . progin = fopen ( input , "rb" ) ;																	//Set the program input as the given file.
-		if ( program . progin == NULL ) {																					//Check if the file has not been opened.
-			strcpy ( program . file . message , "Program input file doesn't exist." ) ;								//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
-			program . file . status = -3 ;
+		client . progin = fopen ( input , "rb" ) ;																	//Set the program input as the given file.
+		if ( client . progin == NULL ) {																			//Check if the file has not been opened.
+			strcpy ( client . message , "Program input file doesn't exist." ) ;								//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+			client . status = -3 ;
 			error_procedure ( ) ;
 		}
 	}
 	else {
-		program . progin = stdin ;																					//Set the program output as the standard output.
+		client . progin = stdin ;																					//Set the program output as the standard output.
 	}
-	program . file . status = 1 ;																					//Set the status to 0 ( meaning executing ).
-	strcpy ( program . file . message , "Interpreting and executing" ) ;											//Set the status message to "Interpreting and executing".
+	setvbuf ( client . progout , NULL , _IONBF , 0 ) ;																//Write the library's output buffer straight to the file, since it is already large.
+	interpreter_input = bf_file_map ( client . progin , & interpreter_input_length ) ;								//Map the program input file into memory if it is a regular file, instead of reading it.
+	client . status = 1 ;																					//Set the status to 0 ( meaning executing ).
+	strcpy ( client . message , "Interpreting and executing" ) ;											//Set the status message to "Interpreting and executing".
 }
 
-void increment_program_list_pointer ( ) {
-	if ( program . list . list_position -> next_node != NULL ) {													//Check if a node after the current node already exists.
-		program . list . list_position = program . list . list_position -> next_node ;								//Move to the next node since it exists already.
-	}
-	else {																											//A node next to the current node doesn't exist.
-		program . list . list_position -> next_node = ( struct program_list_node * )
-			malloc ( sizeof ( struct program_list_node ) ) ;														//Create a program list node after the current node for the program to operate on.
-		program . list . list_position -> next_node -> previous_node = program . list . list_position ;				//Set the previous node of the new node as the current node.
-		program . list . list_position = program . list . list_position -> next_node ;								//Set the current node as the newly created node.
-		program . list . list_position -> value = 0 ;																//Set the value of the new current node as 0, since it has just been created.
-		program . list . list_position -> next_node = NULL ;														//Set the next node of the new current node as NULL, since no node after the current node exists.
-	}
-}
-
-void decrement_program_list_pointer ( ) {
-	if ( program . list . list_position -> previous_node != NULL ) {												//Check if a node before the current node already exists.
-		program . list . list_position = program . list . list_position -> previous_node ;							//Move to the previous node since it exists already.
-	}
-	else {																											//A node previous to the current node doesn't exist.
-		program . list . list_position -> previous_node = ( struct program_list_node * )
-			malloc ( sizeof ( struct program_list_node ) ) ;														//Create a program list node before the current node for the program to operate on.
-		program . list . list_position -> previous_node -> next_node = program . list . list_position ;				//Set the next node of the new node as the current node.
-		program . list . list_position = program . list . list_position -> previous_node ;							//Set the current node as the newly created node.
-		program . list . list_position -> value = 0 ;																//Set the value of the new current node as 0, since it has just been created.
-		program . list . list_position -> previous_node = NULL ;													//Set the previous node of the new current node as NULL, since no node after the current node exists.
-	}
-}
-
-void increment_program_list_pointer_value ( ) {
-	program . list . list_position -> value ++ ;																	//Increment the value of the current program stack node.
-}
-
-void decrement_program_list_pointer_value ( ) {
-	program . list . list_position -> value -- ;																	//Decrement the value of the current program stack node.
-}
-
-void output_program_list_pointer_value ( ) {
-	fputc ( program . list . list_position -> value , program . progout ) ;											//Output the value of the current program stack node.
-}
-
-void input_program_list_pointer_value ( ) {
-	program . list . list_position -> value = fgetc ( program . progin ) ;											//Take input of the value of the current program stack node.
-}
-
-int check_start_loop ( ) {
-	if ( program . list . list_position -> value != 0 ) {															//Check if the value of the current program stack node is not 0.
-		return 1 ;																									//Return 1 ( true ) as the value of the current program stack node is not 0.
+int interpreter_batch_run ( char * program_file , char * output ) {
+	client . source = fopen ( program_file , "rb" ) ;														//Open the program source file.
+	if ( client . source == NULL ) {																		//Check if the file has not been opened.
+		strcpy ( client . message , "Source file doesn't exist." ) ;										//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		client . status = -2 ;
+		error_procedure ( ) ;
 	}
-	else {
-		return 0 ;																									//Return 0 ( false ) as the value of the current program stack node is 0.
+	if ( client . profile ) {																			//Check if the runs were to be profiled, which only a single run can report.
+		strcpy ( client . message , "Profiling can't be used in batch mode." ) ;
+		client . status = -9 ;
+		error_procedure ( ) ;
 	}
+	interpreter_compile ( ) ;																						//Load the program source file and compile it once for every run.
+	client . status = batch_run ( interpreter , compiled , interpreter_batch , output , interpreter_jobs ) ;
+	bf_program_destroy ( compiled ) ;
+	bf_context_destroy ( interpreter ) ;
+	return client . status ;																				//Return the status of the first run that failed, if any did.
 }
 
-void start_loop ( ) {
-	if ( program . list . loop_top == NULL ) {																		//Check if a loop stack has been started.
-		program . list . loop_top = ( struct loop_stack_node * ) malloc ( sizeof ( struct loop_stack_node ) ) ;		//Create a new loop node to signify the start of a loop.
-		program . list . loop_top -> outer_loop_node = NULL ;														//Set the inner loop of the current loop as NULL, since no inner loop has been started yet.
+void interpreter_compile ( ) {
+	long long length ;
+	char * source = bf_file_load ( client . source , & length ) ;											//Read the whole program source file.
+	int status ;
+	fclose ( client . source ) ;																			//Close the program source file, since it has been read completely.
+	client . source = NULL ;
+	if ( source == NULL ) {																							//Check if the source buffer could not be allocated.
+		strcpy ( client . message , "Not enough memory to load the source file." ) ;						//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
+		client . status = -5 ;
+		error_procedure ( ) ;
 	}
-	else if ( program . list . loop_top -> start_pointer_position != program . file . pointer . position ) {		//Check whether the current loop node is not the loop we're starting at.
-		struct loop_stack_node * tmp = ( struct loop_stack_node * ) malloc ( sizeof ( struct loop_stack_node ) ) ;	//Create a new loop node to which will be at the top of the loop stack ( since it is the one within which all further executions will occur under ).
-		tmp -> outer_loop_node = program . list . loop_top ;														//Set the outer loop of the newly created loop node as the current loop top node.
-		program . list . loop_top  = tmp ;																			//Set the current loop top node as the newly created loop node.
+	status = bf_compile ( interpreter , source , length , & compiled ) ;											//Load, optimize and compile the program instructions.
+	free ( source ) ;
+	if ( status != BF_OK ) {
+		interpreter_error ( status ) ;
 	}
-	program . list . loop_top -> start_pointer_position = program . file . pointer . position ;						//Set the start position of the new current loop top node as the position of the input pointer.
 }
 
-void skip_loop ( ) {
-	short int skip_flag = 0 ;																						//Set a flag to check whether the skip is successful as 0 ( false )
-	long long inner_loops = 0 ;																						//Set a counter for counting the presence of inner loops within the current loop.
-	if ( ( program . list . loop_top != NULL ) &&
-		( program . list . loop_top -> start_pointer_position == program . file . pointer . position ) ) {			//Check whether the current loop node is the loop we're starting at.
-		struct loop_stack_node * tmp = program . list . loop_top ;													//Store the current loop node in a temporary variable for deletion.
-		program . list . loop_top = program . list . loop_top -> outer_loop_node ;									//Set the current loop as the outer loop node.
-		free ( tmp ) ;																								//Delete the old loop node from the stack.
-	}
-	while ( ( program . file . pointer . value = fgetc ( program . file . source ) ) != EOF ) {						//Read a character from the program source code.
-		program . file . pointer . position = ftell ( program . file . source ) ;									//Get the file cursors current position.
-		if ( program . file . pointer . value == '[' ) {															//Check if we reached the the start of an inner loop.
-			inner_loops ++ ;																						//Increment the inner loop counter.
-		}
-		else if ( ( inner_loops != 0 ) && ( program . file . pointer . value == ']' ) ) {							//Check if we reached the end of an inner loop.
-			inner_loops -- ;																						//Decrement the inner loop counter.
-		}
-		else if ( ( inner_loops == 0 ) && ( program . file . pointer . value == ']' ) ) {							//Check if we reached the end of the started loop.
-			skip_flag = 1 ;																							//Set the loop skipped flag to 1 ( true )
-			break ;																									//Break from the input parsing loop.
-		}
-	}
-	if ( ! skip_flag ) {																							//Check if the loop has not been skipped.
-		strcpy ( program . file . message , "Unmatched start loop encountered." ) ;									//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
-		program . file . status = -3 ;
-		error_procedure ( ) ;
-	}
+/**
+ * The read function that reads the program input file for the library.
+ * Returns the number of bytes read, or 0 at the end of the file.
+ */
+long long interpreter_read ( void * user , uint8_t * buffer , long long capacity ) {
+	( void ) user ;
+	return bf_file_read ( client . progin , buffer , capacity ) ;
 }
 
-void end_loop ( ) {
-	if ( program . list . loop_top == NULL ) {																		//Check if a loop stack has been started.
-		strcpy ( program . file . message , "Unmatched end loop encountered." ) ;									//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
-		program . file . status = -4 ;
-		error_procedure ( ) ;
-	}
-	else {
-		fseek ( program . file . source
-			, ( program . list . loop_top -> start_pointer_position - 1 )
-			, SEEK_SET ) ;																							//Set the file pointer to the position just behind the start of the loop.
-		program . file . pointer . position = program . list . loop_top -> start_pointer_position - 1 ;				//Set the pointer position to the position just behind the start of the loop.
-	}
+/**
+ * The write function that writes the program output file for the library.
+ * Returns the number of bytes written.
+ */
+long long interpreter_write ( void * user , const uint8_t * data , long long length ) {
+	( void ) user ;
+	return bf_file_write ( client . progout , data , length ) ;
 }
 
 void interpreter_exec ( ) {
-	while ( ( program . file . pointer . value = fgetc ( program . file . source ) ) != EOF ) {						//Read a character from the program source code.
-		program . file . pointer . position = ftell ( program . file . source ) ;									//Get the file cursors current position.
-		switch ( program . file . pointer . value ) {																//Decide the action to perform depending on the character read from the program.
-			case '>' : increment_program_list_pointer ( ) ; break ;													//Increment the program list pointer and break from the switch.
-			case '<' : decrement_program_list_pointer ( ) ; break ;													//Decrement the program list pointer and break from the switch.
-			case '+' : increment_program_list_pointer_value ( ) ; break ;											//Increment the program list pointer value and break from the switch.
-			case '-' : decrement_program_list_pointer_value ( ) ; break ;											//Decrement the program list pointer value and break from the switch.
-			case '.' : output_program_list_pointer_value ( ) ; break ;												//Output the program list pointer value and break from the switch.
-			case ',' : input_program_list_pointer_value ( ) ; break ;												//Input the program list pointer value and break from the switch.
-			case '[' : if ( check_start_loop ( ) ) start_loop ( ) ;													//Check if a loop should be started using the current program list pointer value and break from the switch.
-					   else skip_loop ( ) ;																			//If yes, start a loop. If no, skip the loop and break from the switch.
-					   break ;
-			case ']' : end_loop ( ) ; break ;																		//End the current loop and break from the switch.
-			default : break ;																						//Do nothing because every other character is treated as a comment and is to be ignored.
-		}
+	struct bf_io io ;
+	int status ;
+	memset ( & io , 0 , sizeof ( io ) ) ;
+	io . input = interpreter_input ;																				//Give the library the mapped program input file, or read it otherwise.
+	io . input_length = interpreter_input_length ;
+	io . read = ( interpreter_input == NULL ) ? interpreter_read : NULL ;
+	io . write = interpreter_write ;
+	io . terminal = bf_file_terminal ( client . progout ) ;
+	status = bf_program_run ( interpreter , compiled , & io ) ;														//Run the program.
+	if ( status != BF_OK ) {
+		interpreter_error ( status ) ;
 	}
-	strcpy ( program . file . message , "Cleaning up." ) ;															//We have hit an unrecoverable error. Set error status and message and call the error procedure function.
-	program . file . status = 2 ;
+	strcpy ( client . message , "Cleaning up." ) ;
+	client . status = 2 ;
 }
 
-void clean_program_list ( ) {
-	struct program_list_node * looper = program . list . list_position ;											//Variable that is gonna be used to loop through the list to deinitialize the nodes.
-	struct program_list_node * tmp ;																				//A temporary variable to hold node address that will be deinitialized.
-	while ( looper -> previous_node != NULL ) {																		//Loop through all the nodes previous to the current node.
-		tmp = looper -> previous_node ;																				//Store the address of the node in a temporary variable for deinitialized.
-		looper -> previous_node = looper -> previous_node -> previous_node ;										//Shift out the node to be deinitialized.
-		free ( tmp ) ;																								//Deinitialized the node.
-	}
-	while ( looper -> next_node != NULL ) {																			//Loop through all the nodes next to the current node.
-		tmp = looper -> next_node ;																					//Store the address of the node in a temporary variable for deinitialized.
-		looper -> next_node = looper -> next_node -> next_node ;													//Shift out the node to be deinitialized.
-		free ( tmp ) ;																								//Deinitialized the node.
-	}
-	free ( program . list . list_position ) ;																		//Delete the final node.
-}
-
-void clean_loop_stack ( ) {
-	struct loop_stack_node * looper = program . list . loop_top ;													//Variable that is gonna be used to loop through the list to deinitialize the nodes.
-	struct loop_stack_node * tmp ;																					//A temporary variable to hold node address that will be deinitialized.
-	while ( looper -> outer_loop_node != NULL ) {																	//Loop through all the nodes previous to the current node.
-		tmp = looper -> outer_loop_node ;																			//Store the address of the node in a temporary variable for deinitialized.
-		looper -> outer_loop_node = looper -> outer_loop_node
-			-> outer_loop_node ;																					//Shift out the node to be deinitialized.
-		free ( tmp ) ;																								//Deinitialized the node.
-	}
-	free ( program . list . loop_top ) ;																			//Delete the final node.
+void interpreter_error ( int status ) {
+	strcpy ( client . message , bf_context_error ( interpreter , & client . position ) ) ;	//Take the error message and location from the library.
+	client . status = status ;
+	error_procedure ( ) ;
 }
 
 void interpreter_clean ( ) {
-	fclose ( program . file . source ) ;																			//Close the program source file.
-	clean_program_list ( ) ;																						//Free the program list from memory.
-	if ( program . list . loop_top != NULL ) {																		//Check if an loop stack exists.
-		clean_loop_stack ( ) ;																						//Free the loop list from memory since it exists.
-	}
-	if ( program . progout != stdout ) {																			//Check if the program output is not the standard output.
-		fclose ( program . progout ) ;																				//Close the program output file.
+	bf_program_destroy ( compiled ) ;																				//Free the compiled program from memory.
+	bf_context_destroy ( interpreter ) ;																			//Free the library context from memory.
+	bf_file_unmap ( interpreter_input , interpreter_input_length ) ;												//Unmap the program input file, if it was mapped.
+	if ( client . progout != stdout ) {																			//Check if the program output is not the standard output.
+		fclose ( client . progout ) ;																				//Close the program output file.
 	}
-	if ( program . progin != stdin ) {																				//Check if the program input is not the standard input.
-		fclose ( program . progin ) ;																				//Close the program input file.
+	if ( client . progin != stdin ) {																				//Check if the program input is not the standard input.
+		fclose ( client . progin ) ;																				//Close the program input file.
 	}
-	program . file . status = 0 ;																					//Set the status to 1 ( meaning completed ).
-	strcpy ( program . file . message , "Completed" ) ;																//Set the status message to "Completed".
+	client . status = 0 ;																					//Set the status to 1 ( meaning completed ).
+	strcpy ( client . message , "Completed" ) ;																//Set the status message to "Completed".
 }
@@ -0,0 +1,5 @@
+TARGET = interpreter
+SOURCES += interpreter.c client.c batch.c
+LIBS += -L$$OUT_PWD -lbf -lpthread
+PRE_TARGETDEPS += $$OUT_PWD/libbf.a
+QMAKE_CFLAGS += -Wall -Wextra -Wshadow -pedantic -Werror -std=c99
\ No newline at end of file
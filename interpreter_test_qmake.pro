@@ -1,2 +1,3 @@
-SOURCES += interpreter.c
-QMAKE_CFLAGS += -Wall -Wextra -Wshadow -pedantic -Werror -std=c99
\ No newline at end of file
+TEMPLATE = subdirs
+CONFIG += ordered
+SUBDIRS += libbf.pro interpreter.pro bfc.pro bench/bench.pro
\ No newline at end of file
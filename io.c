@@ -0,0 +1,204 @@
+/**
+ * Brainfuck Program Input And Output
+ *
+ * Buffers the program output in large blocks instead of writing a character at a time, and takes the program input straight from memory where the caller has it there, such as a memory mapping of the input file.
+ * The input and output are reached through the functions the caller gives, so that any number of programs can run at once.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# if ! defined ( _DEFAULT_SOURCE )
+	# define _DEFAULT_SOURCE 1																						//Needed for the POSIX file functions.
+# endif
+# include <errno.h>
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include "io.h"
+
+# if defined ( __unix__ ) || defined ( __APPLE__ )
+	# define IO_POSIX 1																								//Files can be mapped, and read without waiting for a full buffer.
+	# include <sys/mman.h>
+	# include <sys/stat.h>
+	# include <unistd.h>
+# else
+	# define IO_POSIX 0																								//Only the standard library functions are available.
+# endif
+
+int io_init ( struct program_io * io , const struct bf_io * target , int line ) {
+	io -> read = target -> read ;
+	io -> write = target -> write ;
+	io -> user = target -> user ;
+	io -> output_length = 0 ;
+	io -> output_buffer = NULL ;
+	io -> fixed = ( target -> output != NULL ) ;
+	io -> failed = 0 ;
+	io -> line = line && ( ! io -> fixed ) ;																		//Output kept in memory is never shown a line at a time.
+	io -> input_position = 0 ;
+	io -> input_buffer = NULL ;
+	io -> input_failed = 0 ;
+	io -> mapped = ( target -> input != NULL ) || ( target -> read == NULL ) ;										//Input given in memory, or no input at all, is never read.
+	io -> input = target -> input ;
+	io -> input_length = ( target -> input != NULL ) ? target -> input_length : 0 ;
+	io -> output_bytes = 0 ;
+	io -> output_writes = 0 ;
+	io -> input_bytes = 0 ;
+	io -> input_reads = 0 ;
+	if ( io -> fixed ) {																							//Check if the output is kept in the caller's buffer, which it is written into straight away.
+		io -> output = target -> output ;
+		io -> output_capacity = target -> output_capacity ;
+		if ( io -> output_capacity <= 0 ) {																			//Catch any output at all if the caller's buffer has no room.
+			io -> output = & io -> overflow ;
+			io -> output_capacity = 1 ;
+		}
+	}
+	else {
+		io -> output_buffer = ( uint8_t * ) malloc ( PROGRAM_IO_BUFFER_SIZE ) ;
+		if ( io -> output_buffer == NULL ) {
+			return 0 ;
+		}
+		io -> output = io -> output_buffer ;
+		io -> output_capacity = PROGRAM_IO_BUFFER_SIZE ;
+	}
+	if ( ! io -> mapped ) {
+		io -> input_buffer = ( uint8_t * ) malloc ( PROGRAM_IO_BUFFER_SIZE ) ;
+		if ( io -> input_buffer == NULL ) {
+			return 0 ;
+		}
+		io -> input = io -> input_buffer ;
+	}
+	return 1 ;
+}
+
+void io_output ( struct program_io * io , int value ) {
+	io -> output [ io -> output_length ++ ] = ( uint8_t ) value ;
+	if ( ( io -> output_length == io -> output_capacity ) || ( io -> line && ( value == '\n' ) ) ) {				//Check if the buffer is full, or a line has ended and should be shown.
+		io_flush ( io ) ;
+	}
+}
+
+int io_input ( struct program_io * io ) {
+	if ( io -> input_position == io -> input_length ) {																//Check if the available input has all been consumed.
+		long long read_length ;
+		if ( io -> mapped ) {																						//Check if the whole input was in memory, in which case it has ended.
+			return EOF ;
+		}
+		if ( io -> line ) {																							//Show any prompt before waiting for input.
+			io_flush ( io ) ;
+		}
+		read_length = io -> read ( io -> user , io -> input_buffer , PROGRAM_IO_BUFFER_SIZE ) ;
+		io -> input_reads ++ ;
+		if ( read_length <= 0 ) {																					//Check if the input has ended, or could not be read.
+			io -> input_failed = ( read_length < 0 ) ;
+			return EOF ;
+		}
+		io -> input_length = read_length ;
+		io -> input_position = 0 ;
+	}
+	io -> input_bytes ++ ;
+	return io -> input [ io -> input_position ++ ] ;
+}
+
+void io_flush ( struct program_io * io ) {
+	if ( io -> output_length == 0 ) {
+		return ;
+	}
+	if ( io -> fixed ) {																							//Check if the output is kept in the caller's buffer, in which case it only moves on.
+		if ( io -> output == & io -> overflow ) {																	//Check if the output went past the end of the caller's buffer.
+			io -> failed = 1 ;
+			io -> output_length = 0 ;
+			return ;
+		}
+		io -> output += io -> output_length ;
+		io -> output_capacity -= io -> output_length ;
+		io -> output_bytes += io -> output_length ;
+		io -> output_length = 0 ;
+		if ( io -> output_capacity == 0 ) {																			//Catch the next byte if the caller's buffer is full, since it would not fit.
+			io -> output = & io -> overflow ;
+			io -> output_capacity = 1 ;
+		}
+		return ;
+	}
+	if ( ( io -> write != NULL ) && ( io -> write ( io -> user , io -> output , io -> output_length ) != io -> output_length ) ) {	//Write the buffer out, unless the output is discarded.
+		io -> failed = 1 ;
+	}
+	io -> output_bytes += io -> output_length ;
+	io -> output_writes ++ ;
+	io -> output_length = 0 ;
+}
+
+void io_clean ( struct program_io * io ) {
+	io_flush ( io ) ;
+	free ( io -> output_buffer ) ;
+	free ( io -> input_buffer ) ;
+	io -> output = NULL ;
+	io -> output_buffer = NULL ;
+	io -> input = NULL ;
+	io -> input_buffer = NULL ;
+}
+
+long long io_file_write ( void * file , const uint8_t * data , long long length ) {
+	return ( long long ) fwrite ( data , 1 , ( size_t ) length , ( FILE * ) file ) ;
+}
+
+long long io_file_read ( void * file , uint8_t * buffer , long long capacity ) {
+# if IO_POSIX
+	ssize_t result ;
+	do {																											//Read whatever input is available, without waiting for a full buffer, and read again if a signal cut the read short.
+		result = read ( fileno ( ( FILE * ) file ) , buffer , ( size_t ) capacity ) ;
+	} while ( ( result < 0 ) && ( errno == EINTR ) ) ;
+	return ( result >= 0 ) ? ( long long ) result : -1 ;
+# else
+	int value = fgetc ( ( FILE * ) file ) ;																			//Read a single value, since a full buffer may never arrive.
+	( void ) capacity ;
+	if ( value == EOF ) {
+		return ferror ( ( FILE * ) file ) ? -1 : 0 ;
+	}
+	buffer [ 0 ] = ( uint8_t ) value ;
+	return 1 ;
+# endif
+}
+
+const uint8_t * io_file_map ( FILE * file , long long * length ) {
+	* length = 0 ;
+# if IO_POSIX
+	struct stat status ;
+	if ( ( fstat ( fileno ( file ) , & status ) == 0 ) && S_ISREG ( status . st_mode ) ) {							//Check if the input is a regular file, which can be mapped instead of read.
+		void * mapping ;
+		if ( status . st_size == 0 ) {																				//An empty file has nothing to map, but needs no reading either.
+			return ( const uint8_t * ) "" ;
+		}
+		mapping = mmap ( NULL , ( size_t ) status . st_size , PROT_READ , MAP_PRIVATE , fileno ( file ) , 0 ) ;
+		if ( mapping != MAP_FAILED ) {																				//Fall back to reading the file if it cannot be mapped.
+			* length = ( long long ) status . st_size ;
+			return ( const uint8_t * ) mapping ;
+		}
+	}
+# else
+	( void ) file ;
+# endif
+	return NULL ;
+}
+
+void io_file_unmap ( const uint8_t * mapping , long long length ) {
+# if IO_POSIX
+	if ( ( mapping != NULL ) && ( length > 0 ) ) {
+		munmap ( ( void * ) mapping , ( size_t ) length ) ;															//Unmap the input file.
+	}
+# else
+	( void ) mapping ;
+	( void ) length ;
+# endif
+}
+
+int io_file_terminal ( FILE * file ) {
+# if IO_POSIX
+	return isatty ( fileno ( file ) ) ;																				//Check if the output is shown on a terminal, where it should appear a line at a time.
+# else
+	( void ) file ;
+	return 0 ;
+# endif
+}
@@ -0,0 +1,65 @@
+# ifndef BRAINF_IO_FILE
+	# define BRAINF_IO_FILE 0
+
+	# include <stdio.h>
+	# include <stdint.h>
+	# include "struct.h"
+	# include "libbf.h"
+
+	/**
+	 * The initializer function that sets up the buffers of the program input and output, as described by the given caller input and output.
+	 * Returns 1 ( true ) if the buffers were set up, or 0 ( false ) if there is not enough memory.
+	 */
+	int io_init ( struct program_io * , const struct bf_io * , int ) ;
+
+	/**
+	 * The output function that adds a value to the output buffer, writing the buffer out as the flush policy requires.
+	 */
+	void io_output ( struct program_io * , int ) ;
+
+	/**
+	 * The input function that takes the next value from the input, refilling the input buffer if needed.
+	 * Returns the value, or EOF if there is no input left or it could not be read, which sets the input failure.
+	 */
+	int io_input ( struct program_io * ) ;
+
+	/**
+	 * The flush function that writes out the output buffer.
+	 */
+	void io_flush ( struct program_io * ) ;
+
+	/**
+	 * The cleanup function that writes out the output buffer and frees the buffers.
+	 */
+	void io_clean ( struct program_io * ) ;
+
+	/**
+	 * The file write function that writes output to the given file, for callers which write the program output to a file.
+	 * Returns the number of bytes written.
+	 */
+	long long io_file_write ( void * , const uint8_t * , long long ) ;
+
+	/**
+	 * The file read function that reads whatever input is available from the given file, without waiting for a full buffer.
+	 * Returns the number of bytes read, 0 at the end of the file, or -1 if the file could not be read.
+	 */
+	long long io_file_read ( void * , uint8_t * , long long ) ;
+
+	/**
+	 * The map function that maps the given file into memory, if it is a regular file.
+	 * Returns the mapping, or NULL if the file cannot be mapped and has to be read.
+	 */
+	const uint8_t * io_file_map ( FILE * , long long * ) ;
+
+	/**
+	 * The unmap function that removes a mapping made by the map function.
+	 */
+	void io_file_unmap ( const uint8_t * , long long ) ;
+
+	/**
+	 * The terminal function that tells whether the given file is shown on a terminal.
+	 * Returns 1 ( true ) if it is.
+	 */
+	int io_file_terminal ( FILE * ) ;
+
+#endif
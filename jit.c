@@ -0,0 +1,247 @@
+/**
+ * Brainfuck JIT Engine
+ *
+ * Translates the program instructions into x86-64 machine code in an executable buffer and runs it.
+ * The pointer lives in rbx as the address of the current cell, and the jit table lives in r12.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# if ! defined ( _DEFAULT_SOURCE )
+	# define _DEFAULT_SOURCE 1																						//Needed for anonymous memory mappings.
+# endif
+# include <stddef.h>
+# include <stdint.h>
+# include <stdlib.h>
+# include <string.h>
+# include <time.h>
+# include "jit.h"
+# include "bounds.h"
+
+# if defined ( __x86_64__ ) && ( defined ( __unix__ ) || defined ( __APPLE__ ) )
+	# define JIT_SUPPORTED 1																						//Machine code can be compiled and run on this platform.
+	# include <sys/mman.h>
+# else
+	# define JIT_SUPPORTED 0																						//Only the interpreter engine is available on this platform.
+# endif
+
+# define JIT_OPCODE_SIZE 5																							//The most bytes of an opcode given for every cell width, along with its number of bytes.
+# define JIT_INSTRUCTION_SIZE 64																					//The most bytes of machine code any single instruction compiles to.
+
+/**
+ * The emitter function that appends the given bytes to the machine code.
+ */
+void jit_emit ( struct jit_program * compiled , const uint8_t * bytes , int count ) {
+	memcpy ( compiled -> code + compiled -> size , bytes , count ) ;
+	compiled -> size += count ;
+}
+
+/**
+ * The emitter function that appends a 32 bit value to the machine code.
+ */
+void jit_emit_int32 ( struct jit_program * compiled , int32_t value ) {
+	uint32_t bits = ( uint32_t ) value ;
+	uint8_t bytes [ 4 ] ;
+	bytes [ 0 ] = ( uint8_t ) bits ;																				//Machine code values are little endian.
+	bytes [ 1 ] = ( uint8_t ) ( bits >> 8 ) ;
+	bytes [ 2 ] = ( uint8_t ) ( bits >> 16 ) ;
+	bytes [ 3 ] = ( uint8_t ) ( bits >> 24 ) ;
+	jit_emit ( compiled , bytes , 4 ) ;
+}
+
+/**
+ * The emitter function that appends an instruction addressing the cell at the given offset from rbx, followed by an optional immediate value as wide as a cell.
+ * The opcode is given for every cell width, each starting with its number of bytes.
+ */
+void jit_emit_cell ( struct jit_program * compiled , const uint8_t ( * opcode ) [ JIT_OPCODE_SIZE ] , long long offset , long long immediate , int has_immediate ) {
+	const uint8_t * bytes = opcode [ compiled -> cell ] ;
+	int index ;
+	jit_emit ( compiled , bytes + 1 , bytes [ 0 ] ) ;
+	jit_emit_int32 ( compiled , ( int32_t ) ( offset * compiled -> width ) ) ;										//Offsets are counted in bytes.
+	for ( index = 0 ; has_immediate && ( index < compiled -> width ) ; index ++ ) {									//Append the value little endian, wrapped around to the width of a cell.
+		uint8_t value = ( uint8_t ) ( ( unsigned long long ) immediate >> ( 8 * index ) ) ;
+		jit_emit ( compiled , & value , 1 ) ;
+	}
+}
+
+/**
+ * The emitter function that appends a call through the jit table entry at the given offset.
+ */
+void jit_emit_call ( struct jit_program * compiled , size_t entry ) {
+	const uint8_t call [ ] = { 0x41 , 0xFF , 0x54 , 0x24 , ( uint8_t ) entry } ;									//call [r12+entry]
+	jit_emit ( compiled , call , sizeof ( call ) ) ;
+}
+
+/**
+ * The emitter function that appends the check of rbx against the jit table limits, growing the list if the pointer is outside them.
+ */
+void jit_emit_bounds ( struct jit_program * compiled ) {
+	const uint8_t check [ ] = {
+		0x49 , 0x3B , 0x5C , 0x24 , ( uint8_t ) offsetof ( struct jit_table , low ) ,								//cmp rbx, [r12+low]
+		0x72 , 0x07 ,																								//jb grow
+		0x49 , 0x3B , 0x5C , 0x24 , ( uint8_t ) offsetof ( struct jit_table , high ) ,								//cmp rbx, [r12+high]
+		0x72 , 0x0E ,																								//jb done
+		0x4C , 0x89 , 0xE7 ,																						//grow: mov rdi, r12
+		0x48 , 0x89 , 0xDE ,																						//mov rsi, rbx
+		0x41 , 0xFF , 0x54 , 0x24 , ( uint8_t ) offsetof ( struct jit_table , grow ) ,								//call [r12+grow]
+		0x48 , 0x89 , 0xC3																							//mov rbx, rax
+	} ;																												//done:
+	jit_emit ( compiled , check , sizeof ( check ) ) ;
+}
+
+/**
+ * The patch function that writes a 32 bit jump distance at the given position of the machine code.
+ */
+void jit_patch ( struct jit_program * compiled , long long position , long long target ) {
+	long long size = compiled -> size ;
+	compiled -> size = position ;
+	jit_emit_int32 ( compiled , ( int32_t ) ( target - ( position + 4 ) ) ) ;										//Jump distances are counted from the end of the jump instruction.
+	compiled -> size = size ;
+}
+
+int jit_compile ( struct program_code * code , struct jit_program * compiled , enum program_cell cell ) {
+# if JIT_SUPPORTED
+	const uint8_t prologue [ ] = { 0x55 , 0x53 , 0x41 , 0x54 , 0x49 , 0x89 , 0xFC , 0x48 , 0x89 , 0xF3 } ;			//push rbp ; push rbx ; push r12 ; mov r12, rdi ; mov rbx, rsi
+	const uint8_t epilogue [ ] = { 0x48 , 0x89 , 0xD8 , 0x41 , 0x5C , 0x5B , 0x5D , 0xC3 } ;						//mov rax, rbx ; pop r12 ; pop rbx ; pop rbp ; ret
+	const uint8_t add [ ] [ JIT_OPCODE_SIZE ] = { { 2 , 0x80 , 0x83 } , { 3 , 0x66 , 0x81 , 0x83 } , { 2 , 0x81 , 0x83 } } ;	//add byte, word or dword [rbx+offset], value
+	const uint8_t set [ ] [ JIT_OPCODE_SIZE ] = { { 2 , 0xC6 , 0x83 } , { 3 , 0x66 , 0xC7 , 0x83 } , { 2 , 0xC7 , 0x83 } } ;	//mov byte, word or dword [rbx+offset], value
+	const uint8_t load [ ] [ JIT_OPCODE_SIZE ] = { { 3 , 0x0F , 0xB6 , 0x83 } , { 3 , 0x0F , 0xB7 , 0x83 } , { 2 , 0x8B , 0x83 } } ;	//movzx eax, byte or word [rbx+offset], or mov eax, dword [rbx+offset]
+	const uint8_t multiply [ ] = { 0x69 , 0xC0 } ;																	//imul eax, eax, factor
+	const uint8_t store_sum [ ] [ JIT_OPCODE_SIZE ] = { { 2 , 0x00 , 0x83 } , { 3 , 0x66 , 0x01 , 0x83 } , { 2 , 0x01 , 0x83 } } ;	//add [rbx+offset], al, ax or eax
+	const uint8_t store [ ] [ JIT_OPCODE_SIZE ] = { { 2 , 0x88 , 0x83 } , { 3 , 0x66 , 0x89 , 0x83 } , { 2 , 0x89 , 0x83 } } ;	//mov [rbx+offset], al, ax or eax
+	const uint8_t load_argument [ ] [ JIT_OPCODE_SIZE ] = { { 3 , 0x0F , 0xB6 , 0xB3 } , { 3 , 0x0F , 0xB7 , 0xB3 } , { 2 , 0x8B , 0xB3 } } ;	//movzx esi, byte or word [rbx+offset], or mov esi, dword [rbx+offset]
+	const uint8_t table_argument [ ] = { 0x4C , 0x89 , 0xE7 } ;														//mov rdi, r12
+	const uint8_t pointer_argument [ ] = { 0x48 , 0x89 , 0xDE } ;													//mov rsi, rbx
+	const uint8_t stride_argument [ ] = { 0x48 , 0xC7 , 0xC2 } ;													//mov rdx, stride
+	const uint8_t pointer_result [ ] = { 0x48 , 0x89 , 0xC3 } ;														//mov rbx, rax
+	const uint8_t move [ ] = { 0x48 , 0x81 , 0xC3 } ;																//add rbx, distance
+	const uint8_t check [ ] [ JIT_OPCODE_SIZE ] = { { 3 , 0x80 , 0x3B , 0x00 } , { 4 , 0x66 , 0x83 , 0x3B , 0x00 } , { 3 , 0x83 , 0x3B , 0x00 } } ;	//cmp byte, word or dword [rbx], 0
+	const uint8_t jump_zero [ ] = { 0x0F , 0x84 } ;																	//je distance
+	const uint8_t jump_not_zero [ ] = { 0x0F , 0x85 } ;																//jne distance
+	clock_t start = clock ( ) ;
+	long long index , depth = 0 ;
+	long long * loop_starts ;
+	unsigned long long mask ;
+	compiled -> code = NULL ;
+	compiled -> size = 0 ;
+	compiled -> cell = cell ;
+	compiled -> width = 1 << cell ;
+	compiled -> margin = bounds_margin ( code ) ;																	//Find the farthest cell any stretch reaches from where it starts.
+	mask = ( 1ULL << ( 8 * compiled -> width ) ) - 1 ;																//The bits a cell holds, which values wrap around to.
+	for ( index = 0 ; index < code -> length ; index ++ ) {															//Check every value fits the machine code.
+		struct program_instruction * instruction = & code -> instructions [ index ] ;
+		if ( ( llabs ( instruction -> argument ) > INT32_MAX / compiled -> width ) && ( instruction -> operation != OPERATION_ADD ) && ( instruction -> operation != OPERATION_SET ) ) {
+			return 0 ;																								//Return 0 ( false ) as a distance or factor does not fit the machine code.
+		}
+		if ( ( llabs ( instruction -> offset ) > INT32_MAX / 2 / compiled -> width ) || ( llabs ( instruction -> offset + instruction -> distance ) > INT32_MAX / 2 / compiled -> width ) ) {
+			return 0 ;																								//Return 0 ( false ) as an offset does not fit the machine code.
+		}
+	}
+	if ( compiled -> margin > INT32_MAX / 2 / compiled -> width ) {
+		return 0 ;
+	}
+	compiled -> capacity = ( code -> length + 1 ) * JIT_INSTRUCTION_SIZE + sizeof ( prologue ) + sizeof ( epilogue ) ;
+	void * buffer = mmap ( NULL , compiled -> capacity , PROT_READ | PROT_WRITE , MAP_PRIVATE | MAP_ANONYMOUS , -1 , 0 ) ;	//Map a writable buffer for the machine code.
+	loop_starts = ( long long * ) malloc ( ( code -> length + 1 ) * sizeof ( long long ) ) ;						//Create a stack of the loops started but not yet ended, to patch the jumps with.
+	if ( ( buffer == MAP_FAILED ) || ( loop_starts == NULL ) ) {
+		if ( buffer != MAP_FAILED ) {
+			munmap ( buffer , compiled -> capacity ) ;
+		}
+		free ( loop_starts ) ;
+		return 0 ;
+	}
+	compiled -> code = ( uint8_t * ) buffer ;
+	jit_emit ( compiled , prologue , sizeof ( prologue ) ) ;
+	for ( index = 0 ; index < code -> length ; index ++ ) {															//Go through the program instructions and emit the machine code of each.
+		struct program_instruction * instruction = & code -> instructions [ index ] ;
+		switch ( instruction -> operation ) {
+			case OPERATION_ADD :
+				if ( ( ( unsigned long long ) instruction -> argument & mask ) != 0 ) {								//Skip additions which wrap around to nothing.
+					jit_emit_cell ( compiled , add , instruction -> offset , instruction -> argument , 1 ) ;
+				}
+				break ;
+			case OPERATION_SET :
+				jit_emit_cell ( compiled , set , instruction -> offset , instruction -> argument , 1 ) ;
+				break ;
+			case OPERATION_MULTIPLY :
+				jit_emit_cell ( compiled , load , instruction -> offset , 0 , 0 ) ;
+				if ( instruction -> argument != 1 ) {																//Skip the multiplication by 1 of plain copy loops.
+					jit_emit ( compiled , multiply , sizeof ( multiply ) ) ;
+					jit_emit_int32 ( compiled , ( int32_t ) instruction -> argument ) ;
+				}
+				jit_emit_cell ( compiled , store_sum , instruction -> offset + instruction -> distance , 0 , 0 ) ;
+				break ;
+			case OPERATION_MOVE :
+				jit_emit ( compiled , move , sizeof ( move ) ) ;
+				jit_emit_int32 ( compiled , ( int32_t ) ( instruction -> argument * compiled -> width ) ) ;
+				break ;
+			case OPERATION_SCAN :
+				jit_emit ( compiled , table_argument , sizeof ( table_argument ) ) ;
+				jit_emit ( compiled , pointer_argument , sizeof ( pointer_argument ) ) ;
+				jit_emit ( compiled , stride_argument , sizeof ( stride_argument ) ) ;
+				jit_emit_int32 ( compiled , ( int32_t ) instruction -> argument ) ;
+				jit_emit_call ( compiled , offsetof ( struct jit_table , scan ) ) ;
+				jit_emit ( compiled , pointer_result , sizeof ( pointer_result ) ) ;
+				break ;
+			case OPERATION_OUTPUT :
+				jit_emit_cell ( compiled , load_argument , instruction -> offset , 0 , 0 ) ;
+				jit_emit ( compiled , table_argument , sizeof ( table_argument ) ) ;
+				jit_emit_call ( compiled , offsetof ( struct jit_table , output ) ) ;
+				break ;
+			case OPERATION_INPUT :
+				jit_emit_cell ( compiled , load_argument , instruction -> offset , 0 , 0 ) ;						//Pass the cell in, for the end of input policy that leaves it as it is.
+				jit_emit ( compiled , table_argument , sizeof ( table_argument ) ) ;
+				jit_emit_call ( compiled , offsetof ( struct jit_table , input ) ) ;
+				jit_emit_cell ( compiled , store , instruction -> offset , 0 , 0 ) ;
+				break ;
+			case OPERATION_LOOP_START :
+				jit_emit ( compiled , check [ cell ] + 1 , check [ cell ] [ 0 ] ) ;
+				jit_emit ( compiled , jump_zero , sizeof ( jump_zero ) ) ;
+				loop_starts [ depth ++ ] = compiled -> size ;														//Remember where the jump distance goes, to patch it at the end of the loop.
+				jit_emit_int32 ( compiled , 0 ) ;
+				break ;
+			case OPERATION_LOOP_END :
+				depth -- ;
+				jit_emit ( compiled , check [ cell ] + 1 , check [ cell ] [ 0 ] ) ;
+				jit_emit ( compiled , jump_not_zero , sizeof ( jump_not_zero ) ) ;
+				jit_emit_int32 ( compiled , 0 ) ;
+				jit_patch ( compiled , compiled -> size - 4 , loop_starts [ depth ] + 4 ) ;							//Jump back to the start of the loop body while the cell is not 0.
+				jit_patch ( compiled , loop_starts [ depth ] , compiled -> size ) ;									//Jump past the end of the loop when the cell is 0 at its start.
+				break ;
+			case OPERATION_GUARD :
+				jit_emit_bounds ( compiled ) ;																		//Grow the list if the pointer is too close to its ends for the stretch after the guard.
+				break ;
+		}
+	}
+	jit_emit ( compiled , epilogue , sizeof ( epilogue ) ) ;
+	free ( loop_starts ) ;
+	if ( mprotect ( compiled -> code , compiled -> capacity , PROT_READ | PROT_EXEC ) != 0 ) {						//Make the buffer executable, and no longer writable.
+		jit_clean ( compiled ) ;
+		return 0 ;
+	}
+	compiled -> compile_time = ( ( double ) ( clock ( ) - start ) ) / CLOCKS_PER_SEC ;
+	return 1 ;																										//Return 1 ( true ) as the machine code was compiled.
+# else
+	( void ) code ;
+	( void ) cell ;
+	compiled -> code = NULL ;
+	return 0 ;																										//Return 0 ( false ) as machine code cannot be run on this platform.
+# endif
+}
+
+uint8_t * jit_run ( struct jit_program * compiled , struct jit_table * table , uint8_t * cell ) {
+	uint8_t * ( * function ) ( struct jit_table * , uint8_t * ) ;
+	memcpy ( & function , & compiled -> code , sizeof ( function ) ) ;												//Treat the machine code as a function taking the table and the pointer.
+	return function ( table , cell ) ;
+}
+
+void jit_clean ( struct jit_program * compiled ) {
+# if JIT_SUPPORTED
+	if ( compiled -> code != NULL ) {
+		munmap ( compiled -> code , compiled -> capacity ) ;														//Unmap the machine code buffer.
+	}
+# endif
+	compiled -> code = NULL ;
+}
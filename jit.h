@@ -0,0 +1,24 @@
+# ifndef BRAINF_JIT_FILE
+	# define BRAINF_JIT_FILE 0
+
+	# include <stdint.h>
+	# include "struct.h"
+
+	/**
+	 * The compiler function that translates the program instructions into x86-64 machine code working on cells of the given width.
+	 * Returns 1 ( true ) if the machine code was compiled, or 0 ( false ) if the platform or the program is not supported.
+	 */
+	int jit_compile ( struct program_code * , struct jit_program * , enum program_cell ) ;
+
+	/**
+	 * The execution function that runs the machine code with the pointer at the given cell.
+	 * Returns the cell the pointer is at when the program ends.
+	 */
+	uint8_t * jit_run ( struct jit_program * , struct jit_table * , uint8_t * ) ;
+
+	/**
+	 * The cleanup function that frees the machine code.
+	 */
+	void jit_clean ( struct jit_program * ) ;
+
+#endif
@@ -0,0 +1,745 @@
+/**
+ * Brainfuck Library
+ *
+ * Compiles programs once into handles that are never changed, and runs them any number of times, returning errors instead of exiting.
+ * Every call works on the context it is given, so that programs can be embedded in other programs and many of them run at once.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# if ! defined ( _DEFAULT_SOURCE )
+	# define _DEFAULT_SOURCE 1																						//Needed for the POSIX thread functions.
+# endif
+# include <pthread.h>
+# include <setjmp.h>
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include "struct.h"
+# include "libbf.h"
+# include "program.h"
+# include "scan.h"
+# include "io.h"
+# include "jit.h"
+# include "profile.h"
+# include "prefix.h"
+# include "bounds.h"
+
+/**
+ * The error function that stops the running program, returning to the run function with the given status and message.
+ */
+void library_error ( struct program_details * , int , const char * ) ;
+
+/**
+ * The growth function that doubles the size of the program list towards the given direction.
+ */
+void grow_program_list ( struct program_details * , int ) ;
+
+/**
+ * The access function that returns the program list cell at the given offset from the program stack pointer, growing the list if needed.
+ */
+uint8_t * program_list_cell ( struct program_details * , long long ) ;
+
+/**
+ * The reserve function that grows the program list until the cells between the given offsets from the program stack pointer exist, as checked once for every stretch by the bounds analysis.
+ */
+void reserve_program_list ( struct program_details * , long long , long long ) ;
+
+/**
+ * The read function that returns the value at the given offset from the program stack pointer, whatever the width of the cells.
+ */
+uint32_t get_program_list_value ( struct program_details * , long long ) ;
+
+/**
+ * The write function that sets the value at the given offset from the program stack pointer, wrapped around to the width of the cells.
+ */
+void put_program_list_value ( struct program_details * , long long , uint32_t ) ;
+
+/**
+ * The movement function that moves the program stack pointer by the given distance.
+ */
+void move_program_list_pointer ( struct program_details * , long long ) ;
+
+/**
+ * The additive function that adds the given amount to the value at the given offset from the program stack pointer.
+ */
+void add_program_list_pointer_value ( struct program_details * , long long , long long ) ;
+
+/**
+ * The assignment function that sets the value at the given offset from the program stack pointer to the given value.
+ */
+void set_program_list_pointer_value ( struct program_details * , long long , long long ) ;
+
+/**
+ * The multiplicative function that adds the value at the given offset from the program stack pointer times the given factor to the value at the given distance from it.
+ */
+void multiply_program_list_pointer_value ( struct program_details * , long long , long long , long long ) ;
+
+/**
+ * The byte scan function that moves the program stack pointer by the given stride until it reaches a cell holding 0, for cells a byte wide, using the scan kernels.
+ */
+void scan_byte_program_list ( struct program_details * , long long ) ;
+
+/**
+ * The scan function that moves the program stack pointer by the given stride until it reaches a cell holding 0, for cells of any width.
+ */
+void scan_program_list ( struct program_details * , long long ) ;
+
+/**
+ * The output function that outputs the value at the given offset from the program stack pointer.
+ */
+void output_program_list_pointer_value ( struct program_details * , long long ) ;
+
+/**
+ * The input function that inputs the value at the given offset from the program stack pointer, following the given end of input policy once the input has ended.
+ */
+void input_program_list_pointer_value ( struct program_details * , long long , enum program_eof ) ;
+
+/**
+ * The check function that tells whether the loop at the current instruction should be run.
+ * Returns 1 ( true ) if the value of the current program list cell is not 0.
+ */
+int check_start_loop ( struct program_details * ) ;
+
+/**
+ * The execution functions that perform the interpretation and execution of the program, one for every cell width and end of input policy, built from the same engine.
+ */
+# define ENGINE_NAME library_exec_8_unchanged
+# define ENGINE_CELL uint8_t
+# define ENGINE_EOF EOF_UNCHANGED
+# include "engine.h"
+# define ENGINE_NAME library_exec_8_zero
+# define ENGINE_CELL uint8_t
+# define ENGINE_EOF EOF_ZERO
+# include "engine.h"
+# define ENGINE_NAME library_exec_8_minus_one
+# define ENGINE_CELL uint8_t
+# define ENGINE_EOF EOF_MINUS_ONE
+# include "engine.h"
+# define ENGINE_NAME library_exec_16_unchanged
+# define ENGINE_CELL uint16_t
+# define ENGINE_EOF EOF_UNCHANGED
+# include "engine.h"
+# define ENGINE_NAME library_exec_16_zero
+# define ENGINE_CELL uint16_t
+# define ENGINE_EOF EOF_ZERO
+# include "engine.h"
+# define ENGINE_NAME library_exec_16_minus_one
+# define ENGINE_CELL uint16_t
+# define ENGINE_EOF EOF_MINUS_ONE
+# include "engine.h"
+# define ENGINE_NAME library_exec_32_unchanged
+# define ENGINE_CELL uint32_t
+# define ENGINE_EOF EOF_UNCHANGED
+# include "engine.h"
+# define ENGINE_NAME library_exec_32_zero
+# define ENGINE_CELL uint32_t
+# define ENGINE_EOF EOF_ZERO
+# include "engine.h"
+# define ENGINE_NAME library_exec_32_minus_one
+# define ENGINE_CELL uint32_t
+# define ENGINE_EOF EOF_MINUS_ONE
+# include "engine.h"
+
+/**
+ * The once variable that makes sure the scan kernels are picked only once, however many threads create contexts at the same time.
+ */
+pthread_once_t library_scan_once = PTHREAD_ONCE_INIT ;
+
+/**
+ * The engines by cell width and end of input policy, picked once for every run.
+ */
+void ( * const library_engines [ 3 ] [ 3 ] ) ( struct program_details * ) = {
+	{ library_exec_8_unchanged , library_exec_8_zero , library_exec_8_minus_one } ,
+	{ library_exec_16_unchanged , library_exec_16_zero , library_exec_16_minus_one } ,
+	{ library_exec_32_unchanged , library_exec_32_zero , library_exec_32_minus_one }
+} ;
+
+struct bf_context * bf_context_create ( ) {
+	struct bf_context * context = ( struct bf_context * ) calloc ( 1 , sizeof ( struct bf_context ) ) ;				//Create the context with everything set to 0 or empty.
+	if ( context == NULL ) {
+		return NULL ;
+	}
+	context -> details . options . optimization_level = OPTIMIZATION_LEVEL_DEFAULT ;								//Set the options to their defaults.
+	context -> details . options . engine = ENGINE_INTERPRETER ;
+	context -> details . options . flush = FLUSH_AUTO ;
+	context -> details . options . profile = 0 ;
+	context -> details . options . profile_dump = NULL ;
+	context -> details . options . prefix_budget = PREFIX_BUDGET_DEFAULT ;
+	context -> details . options . cell = CELL_8 ;
+	context -> details . options . eof = EOF_MINUS_ONE ;															//An input at the end stores what reading the end returns, wrapped around to the cell.
+	context -> details . list . cells = NULL ;																		//The program list is created by the first run.
+	context -> details . profile . counts = NULL ;
+	context -> details . profile . loop_index = NULL ;
+	context -> details . profile . loops = NULL ;
+	context -> details . progin = NULL ;																			//The program input and output are given to every run instead.
+	context -> details . progout = NULL ;
+	strcpy ( context -> details . file . message , "Ready" ) ;
+	pthread_once ( & library_scan_once , scan_init ) ;																//Pick the scan kernels the processor supports, the first time any context is created.
+	return context ;
+}
+
+struct bf_context * bf_context_copy ( const struct bf_context * original ) {
+	struct bf_context * context = bf_context_create ( ) ;
+	if ( context != NULL ) {
+		context -> details . options = original -> details . options ;												//Take the options, but none of the state of the runs.
+	}
+	return context ;
+}
+
+int bf_context_option ( struct bf_context * context , const char * option ) {
+	struct program_options * options = & context -> details . options ;
+	if ( optimization_option ( options , option ) ) {																//Check if the option is one shared with the compiler.
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--engine=interpreter" ) ) {															//Check if the option picks the interpreter engine.
+		options -> engine = ENGINE_INTERPRETER ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--engine=jit" ) ) {																	//Check if the option picks the JIT engine.
+		options -> engine = ENGINE_JIT ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--flush=auto" ) ) {																	//Check if the option picks the flush policy that suits where the output goes.
+		options -> flush = FLUSH_AUTO ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--flush=line" ) ) {																	//Check if the option picks the interactive flush policy.
+		options -> flush = FLUSH_LINE ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--flush=full" ) ) {																	//Check if the option picks the highest throughput flush policy.
+		options -> flush = FLUSH_FULL ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--cell=8" ) ) {																		//Check if the option picks the width of the cells.
+		options -> cell = CELL_8 ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--cell=16" ) ) {
+		options -> cell = CELL_16 ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--cell=32" ) ) {
+		options -> cell = CELL_32 ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--eof=unchanged" ) ) {																//Check if the option picks what an input does once the input has ended.
+		options -> eof = EOF_UNCHANGED ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--eof=0" ) ) {
+		options -> eof = EOF_ZERO ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--eof=-1" ) ) {
+		options -> eof = EOF_MINUS_ONE ;
+		return BF_OK ;
+	}
+	if ( ! strcmp ( option , "--profile" ) ) {																		//Check if the option profiles the runs, which only the interpreter engine can count.
+		options -> profile = 1 ;
+		return BF_OK ;
+	}
+	return BF_ERROR_ARGUMENT ;																						//Return an error as the option is unknown.
+}
+
+int bf_compile ( struct bf_context * context , const char * source , long long length , struct bf_program * * compiled ) {
+	struct program_details * details = & context -> details ;
+	struct bf_program * program ;
+	* compiled = NULL ;
+	details -> file . pointer . position = 0 ;
+	program = ( struct bf_program * ) calloc ( 1 , sizeof ( struct bf_program ) ) ;
+	if ( program != NULL ) {
+		program -> source = ( char * ) malloc ( length + 1 ) ;														//Keep a copy of the source, since the caller's may not outlive the program.
+	}
+	if ( ( program == NULL ) || ( program -> source == NULL ) ) {
+		bf_program_destroy ( program ) ;
+		program_error ( details , BF_ERROR_MEMORY , "Not enough memory to load the source file." ) ;
+		return BF_ERROR_MEMORY ;
+	}
+	memcpy ( program -> source , source , length ) ;
+	program -> source [ length ] = '\0' ;
+	program -> source_length = length ;
+	program -> cell = details -> options . cell ;																	//Fix the cell width and end of input policy of the program, which its prefix and machine code are built for.
+	program -> eof = details -> options . eof ;
+	details -> code . instructions = NULL ;
+	if ( ( ! program_load ( details , source , length ) ) || ( ! program_optimize ( details ) ) ) {					//Check if the instructions could not be built, in which case the status and message are already set.
+		free ( details -> code . instructions ) ;
+		details -> code . instructions = NULL ;
+		bf_program_destroy ( program ) ;
+		return details -> file . status ;
+	}
+	if ( ! details -> options . profile ) {																			//Run the start of the program now, unless the runs are to count every instruction.
+		prefix_evaluate ( details ) ;
+		program -> prefix = details -> prefix ;																		//Hand the state left by the prefix over to the program.
+		memset ( & details -> prefix , 0 , sizeof ( struct program_prefix ) ) ;
+	}
+	if ( ! bounds_analyze ( & details -> code ) ) {																	//Place the list bounds checks on what is left after the prefix.
+		free ( details -> code . instructions ) ;
+		details -> code . instructions = NULL ;
+		bf_program_destroy ( program ) ;
+		program_error ( details , BF_ERROR_MEMORY , "Not enough memory for the program instructions." ) ;
+		return BF_ERROR_MEMORY ;
+	}
+	program -> code = details -> code ;																				//Hand the instructions over to the program, which owns them from now on.
+	program -> code . counter = 0 ;
+	program -> code . executed = 0 ;
+	details -> code . instructions = NULL ;
+	program -> jit . code = NULL ;
+	if ( ( details -> options . engine == ENGINE_JIT ) && ( ! jit_compile ( & program -> code , & program -> jit , program -> cell ) ) ) {	//Check if the machine code could not be compiled.
+		bf_program_destroy ( program ) ;
+		program_error ( details , BF_ERROR_UNSUPPORTED , "The program could not be compiled by the JIT engine on this platform." ) ;
+		return BF_ERROR_UNSUPPORTED ;
+	}
+	strcpy ( details -> file . message , "Compiled" ) ;
+	* compiled = program ;
+	return BF_OK ;
+}
+
+void library_error ( struct program_details * details , int status , const char * message ) {
+	program_error ( details , status , message ) ;
+	longjmp ( ( ( struct bf_context * ) details ) -> error , 1 ) ;													//The details are the first member of the context, so the context is found from them.
+}
+
+void grow_program_list ( struct program_details * details , int direction ) {
+	long long size = details -> list . size * details -> list . width ;												//The current size of the program list, in bytes.
+	uint8_t * cells = ( uint8_t * ) malloc ( 2 * size * sizeof ( uint8_t ) ) ;										//Create a new array twice the size of the current one.
+	if ( cells == NULL ) {																							//Check if the new array could not be allocated.
+		library_error ( details , BF_ERROR_MEMORY , "Not enough memory for the program list." ) ;					//We have hit an unrecoverable error. Stop the program with the error status and message.
+	}
+	if ( direction > 0 ) {																							//Check if the list has to grow after the last cell.
+		memcpy ( cells , details -> list . cells , size ) ;															//Copy the current cells to the start of the new array and set the new cells after them to 0.
+		memset ( cells + size , 0 , size ) ;
+	}
+	else {																											//The list has to grow before the first cell.
+		memset ( cells , 0 , size ) ;																				//Set the new cells to 0 and copy the current cells to the end of the new array after them.
+		memcpy ( cells + size , details -> list . cells , size ) ;
+		details -> list . position += details -> list . size ;														//Shift the position of the program list pointer to where the current cell has been moved.
+		details -> list . origin += details -> list . size ;
+	}
+	free ( details -> list . cells ) ;																				//Delete the old array and use the new one.
+	details -> list . cells = cells ;
+	details -> list . size *= 2 ;
+}
+
+uint8_t * program_list_cell ( struct program_details * details , long long offset ) {
+	while ( details -> list . position + offset >= details -> list . size ) {										//Check if the cell is after the last cell.
+		grow_program_list ( details , 1 ) ;																			//Grow the list after the last cell.
+	}
+	while ( details -> list . position + offset < 0 ) {																//Check if the cell is before the first cell.
+		grow_program_list ( details , -1 ) ;																		//Grow the list before the first cell.
+	}
+	return details -> list . cells + ( details -> list . position + offset ) * details -> list . width ;			//Return the first byte of the cell, which now exists.
+}
+
+void reserve_program_list ( struct program_details * details , long long low , long long high ) {
+	if ( ( details -> list . position + low < 0 ) || ( details -> list . position + high >= details -> list . size ) ) {	//Check if any cell of the stretch is outside the list, which is rarely the case.
+		program_list_cell ( details , low ) ;
+		program_list_cell ( details , high ) ;
+	}
+}
+
+uint32_t get_program_list_value ( struct program_details * details , long long offset ) {
+	long long index = details -> list . position + offset ;
+	switch ( details -> list . width ) {
+		case 1 : return details -> list . cells [ index ] ;
+		case 2 : return ( ( uint16_t * ) details -> list . cells ) [ index ] ;
+		default : return ( ( uint32_t * ) details -> list . cells ) [ index ] ;
+	}
+}
+
+void put_program_list_value ( struct program_details * details , long long offset , uint32_t value ) {
+	long long index = details -> list . position + offset ;
+	switch ( details -> list . width ) {
+		case 1 : details -> list . cells [ index ] = ( uint8_t ) value ; break ;
+		case 2 : ( ( uint16_t * ) details -> list . cells ) [ index ] = ( uint16_t ) value ; break ;
+		default : ( ( uint32_t * ) details -> list . cells ) [ index ] = value ; break ;
+	}
+}
+
+void move_program_list_pointer ( struct program_details * details , long long distance ) {
+	details -> list . position += distance ;																		//Move the pointer by the given distance. The list was grown for where it moves to at the start of the stretch.
+}
+
+void add_program_list_pointer_value ( struct program_details * details , long long offset , long long value ) {
+	put_program_list_value ( details , offset , get_program_list_value ( details , offset ) + ( uint32_t ) value ) ;	//Add the value to the program list cell, wrapping around like repeated increments would.
+}
+
+void set_program_list_pointer_value ( struct program_details * details , long long offset , long long value ) {
+	put_program_list_value ( details , offset , ( uint32_t ) value ) ;												//Set the value of the program list cell.
+}
+
+void multiply_program_list_pointer_value ( struct program_details * details , long long offset , long long distance , long long factor ) {
+	uint32_t value = get_program_list_value ( details , offset ) * ( uint32_t ) factor ;
+	put_program_list_value ( details , offset + distance , get_program_list_value ( details , offset + distance ) + value ) ;	//Add the cell times the factor to the cell at the distance from it.
+}
+
+void scan_byte_program_list ( struct program_details * details , long long stride ) {
+	struct program_list * list = & details -> list ;
+	long long found ;
+	if ( stride > 0 ) {																								//Check if the scan moves towards the last cell.
+		found = scan_forward ( list -> cells , list -> position , list -> size , stride ) ;
+		if ( found < 0 ) {																							//Check if every cell scanned up to the last cell holds a value, in which case the first cell scanned after it is the new, empty one.
+			found = list -> position + ( ( list -> size - list -> position + stride - 1 ) / stride ) * stride ;
+		}
+	}
+	else {																											//The scan moves towards the first cell.
+		found = scan_backward ( list -> cells , list -> position , - stride ) ;
+		if ( found < 0 ) {																							//Check if every cell scanned down to the first cell holds a value, in which case the first cell scanned before it is the new, empty one.
+			found = list -> position - ( ( list -> position / - stride ) + 1 ) * - stride ;
+		}
+	}
+	list -> position = found ;																						//Move to the cell found.
+	program_list_cell ( details , 0 ) ;																				//Grow the list if the cell found is outside it.
+}
+
+void scan_program_list ( struct program_details * details , long long stride ) {
+	struct program_list * list = & details -> list ;
+	long long found ;
+	if ( list -> width == 1 ) {																						//Check if the cells are a byte wide, which the scan kernels work on.
+		scan_byte_program_list ( details , stride ) ;
+		return ;
+	}
+	for ( found = list -> position ; ( found >= 0 ) && ( found < list -> size ) && ( get_program_list_value ( details , found - list -> position ) != 0 ) ; found += stride ) ;	//Scan the wider cells one at a time.
+	list -> position = found ;
+	program_list_cell ( details , 0 ) ;
+}
+
+void output_program_list_pointer_value ( struct program_details * details , long long offset ) {
+	io_output ( & details -> io , ( uint8_t ) get_program_list_value ( details , offset ) ) ;						//Output the lowest byte of the program list cell.
+	if ( details -> io . failed ) {																					//Check if the output could not be written, or did not fit in the caller's buffer.
+		library_error ( details , BF_ERROR_OUTPUT , "The program output could not be written." ) ;
+	}
+}
+
+void input_program_list_pointer_value ( struct program_details * details , long long offset , enum program_eof eof ) {
+	int value = io_input ( & details -> io ) ;																		//Take input of the value of the program list cell.
+	if ( value != EOF ) {
+		put_program_list_value ( details , offset , ( uint32_t ) value ) ;
+	}
+	else if ( details -> io . input_failed ) {																		//Stop the program if the input could not be read, rather than take it as ended.
+		library_error ( details , BF_ERROR_INPUT , "The program input could not be read." ) ;
+	}
+	else if ( eof == EOF_ZERO ) {																					//Follow the end of input policy, leaving the cell as it is for any other.
+		put_program_list_value ( details , offset , 0 ) ;
+	}
+	else if ( eof == EOF_MINUS_ONE ) {
+		put_program_list_value ( details , offset , ( uint32_t ) -1 ) ;
+	}
+}
+
+int check_start_loop ( struct program_details * details ) {
+	return get_program_list_value ( details , 0 ) != 0 ;															//Return 1 ( true ) if the value of the current program list cell is not 0.
+}
+
+/**
+ * The jit growth function that grows the program list until the cells within the margin on either side of the pointer exist.
+ * Returns the pointer, moved along with the list.
+ */
+uint8_t * jit_grow_program_list ( struct jit_table * table , uint8_t * cell ) {
+	struct program_details * details = table -> details ;
+	int width = details -> list . width ;
+	details -> list . position = ( cell - details -> list . cells ) / width ;										//Find the position of the pointer in the list.
+	program_list_cell ( details , - table -> margin ) ;																//Grow the list on the side the pointer is close to.
+	program_list_cell ( details , table -> margin ) ;
+	table -> low = details -> list . cells + table -> margin * width ;												//Set the limits within which the pointer may move without growing the list.
+	table -> high = details -> list . cells + ( details -> list . size - table -> margin ) * width ;
+	return details -> list . cells + details -> list . position * width ;
+}
+
+/**
+ * The jit scan function that moves the pointer by the given stride until it reaches a cell holding 0.
+ * Returns the moved pointer.
+ */
+uint8_t * jit_scan_program_list ( struct jit_table * table , uint8_t * cell , long long stride ) {
+	struct program_details * details = table -> details ;
+	details -> list . position = ( cell - details -> list . cells ) / details -> list . width ;						//Find the position of the pointer in the list.
+	scan_program_list ( details , stride ) ;
+	return jit_grow_program_list ( table , details -> list . cells + details -> list . position * details -> list . width ) ;
+}
+
+/**
+ * The jit output function that outputs the given value.
+ */
+void jit_output_program_list_value ( struct jit_table * table , int value ) {
+	io_output ( & table -> details -> io , ( uint8_t ) value ) ;													//Output the lowest byte of the program list cell.
+	if ( table -> details -> io . failed ) {
+		library_error ( table -> details , BF_ERROR_OUTPUT , "The program output could not be written." ) ;
+	}
+}
+
+/**
+ * The jit read function that inputs a value, stopping the program if the input could not be read.
+ * Returns the value, or EOF at the end of the input.
+ */
+int jit_input_program_list_value ( struct jit_table * table ) {
+	int value = io_input ( & table -> details -> io ) ;																//Take input of the value of the program list cell.
+	if ( ( value == EOF ) && table -> details -> io . input_failed ) {
+		library_error ( table -> details , BF_ERROR_INPUT , "The program input could not be read." ) ;
+	}
+	return value ;
+}
+
+/**
+ * The jit input functions that input a value, one for every end of input policy.
+ * Returns the value to store in the program list cell, given the value it holds.
+ */
+int jit_input_unchanged ( struct jit_table * table , int cell ) {
+	int value = jit_input_program_list_value ( table ) ;
+	return ( value != EOF ) ? value : cell ;
+}
+
+int jit_input_zero ( struct jit_table * table , int cell ) {
+	int value = jit_input_program_list_value ( table ) ;
+	( void ) cell ;
+	return ( value != EOF ) ? value : 0 ;
+}
+
+int jit_input_minus_one ( struct jit_table * table , int cell ) {
+	int value = jit_input_program_list_value ( table ) ;
+	( void ) cell ;
+	return ( value != EOF ) ? value : -1 ;																			//The machine code stores -1 wrapped around to the width of the cell.
+}
+
+/**
+ * The jit input functions by end of input policy.
+ */
+int ( * const jit_inputs [ 3 ] ) ( struct jit_table * , int ) = { jit_input_unchanged , jit_input_zero , jit_input_minus_one } ;
+
+/**
+ * The JIT execution function that runs the program as machine code, following the given end of input policy.
+ */
+void library_exec_jit ( struct program_details * details , enum program_eof eof ) {
+	struct jit_table table ;
+	table . grow = jit_grow_program_list ;																			//Fill the table the machine code reaches the program list and the program input and output through.
+	table . scan = jit_scan_program_list ;
+	table . output = jit_output_program_list_value ;
+	table . input = jit_inputs [ eof ] ;
+	table . margin = details -> jit . margin ;
+	table . details = details ;
+	uint8_t * cell = jit_grow_program_list ( & table , details -> list . cells + details -> list . position * details -> list . width ) ;	//Grow the list around the pointer before running the machine code.
+	cell = jit_run ( & details -> jit , & table , cell ) ;
+	details -> list . position = ( cell - details -> list . cells ) / details -> list . width ;						//Store the position the pointer ended at.
+}
+
+/**
+ * The profiled execution function that runs the program instructions one at a time, counting every instruction and loop, and the cells reached.
+ * Works on cells of any width, and follows the given end of input policy.
+ */
+void library_exec_profile ( struct program_details * details , enum program_eof eof ) {
+	struct program_profile * profile = & details -> profile ;
+	struct program_code * code = & details -> code ;
+	for ( code -> counter = 0 ; code -> counter < code -> length ; code -> counter ++ ) {							//Go through the program instructions one at a time.
+		struct program_instruction * instruction = & code -> instructions [ code -> counter ] ;
+		struct profile_loop * loop = NULL ;
+		long long cell ;
+		if ( instruction -> operation == OPERATION_GUARD ) {														//Grow the list for the stretch after the guard, which is not an instruction of the program and so is not counted.
+			reserve_program_list ( details , instruction -> low , instruction -> high ) ;
+			continue ;
+		}
+		code -> executed ++ ;
+		profile -> counts [ code -> counter ] ++ ;																	//Count the instruction.
+		switch ( instruction -> operation ) {
+			case OPERATION_MOVE : move_program_list_pointer ( details , instruction -> argument ) ; break ;
+			case OPERATION_ADD : add_program_list_pointer_value ( details , instruction -> offset , instruction -> argument ) ; break ;
+			case OPERATION_SET : set_program_list_pointer_value ( details , instruction -> offset , instruction -> argument ) ; break ;
+			case OPERATION_MULTIPLY : multiply_program_list_pointer_value ( details , instruction -> offset , instruction -> distance , instruction -> argument ) ;
+				cell = details -> list . position - details -> list . origin + instruction -> offset + instruction -> distance ;	//Count the cell added to, as well as the cell read.
+				profile -> low = ( cell < profile -> low ) ? cell : profile -> low ;
+				profile -> high = ( cell > profile -> high ) ? cell : profile -> high ;
+				break ;
+			case OPERATION_OUTPUT : output_program_list_pointer_value ( details , instruction -> offset ) ; break ;
+			case OPERATION_INPUT : input_program_list_pointer_value ( details , instruction -> offset , eof ) ; break ;
+			case OPERATION_SCAN : scan_program_list ( details , instruction -> argument ) ; break ;
+			case OPERATION_LOOP_START : loop = & profile -> loops [ profile -> loop_index [ code -> counter ] ] ;
+				loop -> entries ++ ;																				//Count the entry into the loop, and its first iteration unless it is skipped.
+				if ( ! check_start_loop ( details ) ) {
+					profile_loop_end ( loop ) ;
+					code -> counter = instruction -> jump ;
+				}
+				else {
+					loop -> current = 1 ;
+				}
+				break ;
+			case OPERATION_LOOP_END : loop = & profile -> loops [ profile -> loop_index [ code -> counter ] ] ;
+				if ( check_start_loop ( details ) ) {																//Count another iteration if the loop runs again, or record how many it ran otherwise.
+					loop -> current ++ ;
+					code -> counter = instruction -> jump ;
+				}
+				else {
+					profile_loop_end ( loop ) ;
+				}
+				break ;
+			default : break ;
+		}
+		cell = details -> list . position - details -> list . origin + instruction -> offset ;						//Widen the extent of the tape to the cell the instruction worked on.
+		profile -> low = ( cell < profile -> low ) ? cell : profile -> low ;
+		profile -> high = ( cell > profile -> high ) ? cell : profile -> high ;
+	}
+}
+
+/**
+ * The list function that gives the run a fresh program list of cells of the given width, holding the cells left by the prefix, reusing the list of the last run if it is the same size.
+ */
+void library_list ( struct program_details * details , const struct program_prefix * prefix , enum program_cell cell ) {
+	long long size = PROGRAM_LIST_INITIAL_SIZE , index ;
+	int width = 1 << cell ;
+	while ( size < prefix -> length ) {																				//Make room for the cells left by the prefix.
+		size *= 2 ;
+	}
+	if ( ( details -> list . cells != NULL ) && ( details -> list . size == size ) && ( details -> list . width == width ) ) {	//Check if the list of the last run can be cleared instead of created again.
+		memset ( details -> list . cells , 0 , size * width ) ;
+	}
+	else {
+		free ( details -> list . cells ) ;
+		details -> list . size = size ;
+		details -> list . width = width ;
+		details -> list . cells = ( uint8_t * ) calloc ( details -> list . size , width ) ;							//Create the program list cells, all set to 0, for the program to operate on. The list will be grown as required.
+		if ( details -> list . cells == NULL ) {																	//Check if the program list could not be allocated.
+			details -> list . size = 0 ;
+			library_error ( details , BF_ERROR_MEMORY , "Not enough memory for the program list." ) ;
+		}
+	}
+	if ( prefix -> length != 0 ) {
+		memcpy ( details -> list . cells , prefix -> cells , prefix -> length * width ) ;
+	}
+	details -> list . position = prefix -> position ;																//Set the position of the program list pointer to where the prefix left it, which is the first cell if there was no prefix.
+	details -> list . origin = prefix -> origin ;
+	for ( index = 0 ; index < prefix -> output_length ; index ++ ) {												//Output what the prefix did, before the rest of the program runs.
+		io_output ( & details -> io , prefix -> output [ index ] ) ;
+	}
+}
+
+int bf_program_run ( struct bf_context * context , const struct bf_program * program , struct bf_io * io ) {
+	struct program_details * details = & context -> details ;
+	int line = ( details -> options . flush == FLUSH_LINE ) || ( ( details -> options . flush == FLUSH_AUTO ) && io -> terminal ) ;
+	details -> code = program -> code ;																				//Run a copy of the instructions, so that the program itself is never changed.
+	details -> code . counter = 0 ;
+	details -> code . executed = 0 ;
+	details -> jit = program -> jit ;
+	details -> file . pointer . position = 0 ;
+	details -> file . status = BF_OK ;
+	strcpy ( details -> file . message , "Interpreting and executing" ) ;
+	profile_clean ( & details -> profile ) ;																		//Forget the counters of the last run.
+	context -> jit = ( program -> jit . code != NULL ) && ( ! details -> options . profile ) ;
+	context -> profiled = details -> options . profile ;
+	if ( ! io_init ( & details -> io , io , line ) ) {																//Set up the buffered program input and output.
+		io_clean ( & details -> io ) ;
+		context -> profiled = 0 ;
+		program_error ( details , BF_ERROR_MEMORY , "Not enough memory for the program input and output buffers." ) ;
+		return BF_ERROR_MEMORY ;
+	}
+	if ( setjmp ( context -> error ) == 0 ) {																		//Run the program, coming back here with the status set if it hits an error.
+		library_list ( details , & program -> prefix , program -> cell ) ;
+		if ( context -> profiled && ( ! profile_init ( & details -> profile , & details -> code ) ) ) {				//Check if the counters could not be allocated.
+			context -> profiled = 0 ;
+			library_error ( details , BF_ERROR_MEMORY , "Not enough memory for the profile counters." ) ;
+		}
+		if ( context -> jit ) {																						//Check if the program is to be run as machine code.
+			library_exec_jit ( details , program -> eof ) ;
+		}
+		else if ( context -> profiled ) {																			//Check if the program is to be run with the execution counters.
+			library_exec_profile ( details , program -> eof ) ;
+		}
+		else {
+			library_engines [ program -> cell ] [ program -> eof ] ( details ) ;									//Run the engine built for the cell width and end of input policy of the program.
+		}
+		io_flush ( & details -> io ) ;																				//Write out the program output left in the buffer.
+		if ( details -> io . failed ) {
+			library_error ( details , BF_ERROR_OUTPUT , "The program output could not be written." ) ;
+		}
+		strcpy ( details -> file . message , "Completed" ) ;
+	}
+	io_clean ( & details -> io ) ;																					//Write out any program output left before an error, and free the buffers.
+	io -> output_length = details -> io . output_bytes ;
+	details -> code . instructions = NULL ;																			//The instructions belong to the program.
+	return details -> file . status ;
+}
+
+const char * bf_context_error ( const struct bf_context * context , long long * position ) {
+	if ( position != NULL ) {
+		* position = context -> details . file . pointer . position ;
+	}
+	return context -> details . file . message ;
+}
+
+void bf_context_stats ( const struct bf_context * context , const struct bf_program * program , struct bf_stats * stats ) {
+	const struct program_io * io = & context -> details . io ;
+	stats -> jit = context -> jit ;
+	stats -> instructions = program -> code . length - program -> code . guards ;									//Leave out the guards, which are not instructions of the program.
+	stats -> executed = context -> details . code . executed ;
+	stats -> prefix_executed = program -> prefix . executed ;
+	stats -> bounds_checks = program -> code . checks ;
+	stats -> bounds_guards = program -> code . guards ;
+	stats -> machine_code_size = ( program -> jit . code != NULL ) ? program -> jit . size : 0 ;
+	stats -> compile_time = ( program -> jit . code != NULL ) ? program -> jit . compile_time : 0 ;
+	stats -> output_bytes = io -> output_bytes ;
+	stats -> output_writes = io -> output_writes ;
+	stats -> input_bytes = io -> input_bytes ;
+	stats -> input_reads = io -> mapped ? -1 : io -> input_reads ;
+}
+
+int bf_profile_report ( struct bf_context * context , const struct bf_program * program , FILE * out ) {
+	if ( ! context -> profiled ) {																					//Check if the last run was not profiled, in which case there are no counters.
+		return BF_ERROR_ARGUMENT ;
+	}
+	profile_report ( & context -> details . profile , & program -> code , program -> source , program -> source_length , out ) ;
+	return BF_OK ;
+}
+
+int bf_profile_dump ( struct bf_context * context , const struct bf_program * program , const char * dump_file ) {
+	if ( ! context -> profiled ) {
+		return BF_ERROR_ARGUMENT ;
+	}
+	if ( ! profile_dump ( & context -> details . profile , & program -> code , dump_file ) ) {
+		return BF_ERROR_OUTPUT ;
+	}
+	return BF_OK ;
+}
+
+char * bf_file_load ( FILE * file , long long * length ) {
+	return program_read ( file , length ) ;
+}
+
+long long bf_file_read ( void * file , uint8_t * buffer , long long capacity ) {
+	return io_file_read ( file , buffer , capacity ) ;
+}
+
+long long bf_file_write ( void * file , const uint8_t * data , long long length ) {
+	return io_file_write ( file , data , length ) ;
+}
+
+const uint8_t * bf_file_map ( FILE * file , long long * length ) {
+	return io_file_map ( file , length ) ;
+}
+
+void bf_file_unmap ( const uint8_t * mapping , long long length ) {
+	io_file_unmap ( mapping , length ) ;
+}
+
+int bf_file_terminal ( FILE * file ) {
+	return io_file_terminal ( file ) ;
+}
+
+void bf_program_destroy ( struct bf_program * program ) {
+	if ( program == NULL ) {
+		return ;
+	}
+	jit_clean ( & program -> jit ) ;																				//Free the machine code from memory, if any was compiled.
+	prefix_clean ( & program -> prefix ) ;																			//Free the state left by the prefix.
+	free ( program -> code . instructions ) ;																		//Free the program instructions array.
+	free ( program -> source ) ;
+	free ( program ) ;
+}
+
+void bf_context_destroy ( struct bf_context * context ) {
+	if ( context == NULL ) {
+		return ;
+	}
+	free ( context -> details . list . cells ) ;																	//Free the program list cells array.
+	profile_clean ( & context -> details . profile ) ;																//Free the execution counters from memory, if the last run was profiled.
+	free ( context ) ;
+}
@@ -0,0 +1,164 @@
+# ifndef BRAINF_LIBBF_FILE
+	# define BRAINF_LIBBF_FILE 0
+
+	# include <stdint.h>
+	# include <stdio.h>
+
+	/**
+	 * The context a program is compiled and run in, holding the options, the program list and the error of the last call.
+	 * A context is used by one thread at a time, but any number of contexts may be used at once.
+	 */
+	struct bf_context ;
+
+	/**
+	 * A compiled program, which is never changed once compiled, so that it can be run any number of times, from any number of contexts at once.
+	 */
+	struct bf_program ;
+
+	/**
+	 * The statuses the library calls return.
+	 */
+	enum bf_status {
+		BF_OK = 0 ,																//The call succeeded.
+		BF_ERROR_UNMATCHED_START = -3 ,											//The program has a loop start without a matching end.
+		BF_ERROR_UNMATCHED_END = -4 ,											//The program has a loop end without a matching start.
+		BF_ERROR_MEMORY = -5 ,													//There is not enough memory.
+		BF_ERROR_UNSUPPORTED = -6 ,												//The JIT engine cannot compile the program on this platform.
+		BF_ERROR_OUTPUT = -8 ,													//The program output could not be written, or did not fit in the output buffer.
+		BF_ERROR_ARGUMENT = -9 ,												//An option or argument given to the call is not valid.
+		BF_ERROR_INPUT = -10													//The program input could not be read.
+	} ;
+
+	/**
+	 * The program input and output of a run, either held in memory or reached through functions.
+	 */
+	struct bf_io {
+		const uint8_t * input ;													//The whole program input, or NULL to read it through the read function.
+		long long input_length ;												//The number of bytes of program input.
+		long long ( * read ) ( void * , uint8_t * , long long ) ;				//The function that reads up to the given number of bytes of input, returning how many were read, 0 at the end of the input, or a negative number if it could not be read. NULL for no input.
+		uint8_t * output ;														//The buffer the whole program output is kept in, or NULL to write it through the write function.
+		long long output_capacity ;												//The number of bytes the output buffer can hold.
+		long long output_length ;												//The number of bytes of program output, set when the run ends.
+		long long ( * write ) ( void * , const uint8_t * , long long ) ;		//The function that writes the given bytes of output, returning how many were written. NULL to discard the output.
+		void * user ;															//The value given to the read and write functions.
+		int terminal ;															//Whether the output is shown on a terminal, where the automatic flush policy writes it a line at a time.
+	} ;
+
+	/**
+	 * The statistics of the last run of a context.
+	 */
+	struct bf_stats {
+		int jit ;																//Whether the program was run as machine code.
+		long long instructions ;												//The number of instructions of the program, leaving out the bounds checks.
+		long long executed ;													//The number of instructions executed, if the run was profiled.
+		long long prefix_executed ;												//The number of instructions of the prefix, run once when the program was compiled.
+		long long bounds_checks ;												//The number of program list bounds checks the instructions would make on their own.
+		long long bounds_guards ;												//The number of those checks kept by the bounds analysis, at the start of every stretch.
+		long long machine_code_size ;											//The size of the machine code, if the program was compiled by the JIT engine.
+		double compile_time ;													//The CPU time taken to compile the machine code.
+		long long output_bytes ;												//The number of bytes output.
+		long long output_writes ;												//The number of times the output was written out.
+		long long input_bytes ;													//The number of bytes input.
+		long long input_reads ;													//The number of times input was read, or -1 if the whole input was in memory.
+	} ;
+
+	/**
+	 * The creation function that makes a context with the default options.
+	 * Returns the context, or NULL if there is not enough memory.
+	 */
+	struct bf_context * bf_context_create ( ) ;
+
+	/**
+	 * The copy function that makes a context with the same options as the given one, for running the same programs on another thread.
+	 * Returns the context, or NULL if there is not enough memory.
+	 */
+	struct bf_context * bf_context_copy ( const struct bf_context * ) ;
+
+	/**
+	 * The option function that sets an option of the context, written the same as on the interpreter command line, such as --optimize=2 or --engine=jit.
+	 * Returns BF_OK, or BF_ERROR_ARGUMENT if the option is unknown.
+	 */
+	int bf_context_option ( struct bf_context * , const char * ) ;
+
+	/**
+	 * The compile function that loads, optimizes and, for the JIT engine, compiles the given program source with the options of the context.
+	 * The start of the program that does not depend on the input is run once here, unless the runs are profiled, and every run starts from the state it left.
+	 * The cell width and end of input policy of the context are fixed for the program here, and every run uses them, whichever context it is run from.
+	 * Returns BF_OK with the program set, or an error status with the error of the context set.
+	 */
+	int bf_compile ( struct bf_context * , const char * , long long , struct bf_program * * ) ;
+
+	/**
+	 * The run function that runs a compiled program on a fresh program list, with the given program input and output.
+	 * Returns BF_OK, or an error status with the error of the context set.
+	 */
+	int bf_program_run ( struct bf_context * , const struct bf_program * , struct bf_io * ) ;
+
+	/**
+	 * The error function that describes the error of the last call of the context.
+	 * Returns the message, and sets the byte position in the program source the error was found at, if a position is given.
+	 */
+	const char * bf_context_error ( const struct bf_context * , long long * ) ;
+
+	/**
+	 * The statistics function that fills in the statistics of the last run of the context.
+	 */
+	void bf_context_stats ( const struct bf_context * , const struct bf_program * , struct bf_stats * ) ;
+
+	/**
+	 * The profile report function that writes the hottest loops of the last profiled run of the context to the given file.
+	 * Returns BF_OK, or BF_ERROR_ARGUMENT if the run was not profiled.
+	 */
+	int bf_profile_report ( struct bf_context * , const struct bf_program * , FILE * ) ;
+
+	/**
+	 * The profile dump function that writes every counter of the last profiled run of the context to the given file as JSON.
+	 * Returns BF_OK, BF_ERROR_ARGUMENT if the run was not profiled, or BF_ERROR_OUTPUT if the file could not be written.
+	 */
+	int bf_profile_dump ( struct bf_context * , const struct bf_program * , const char * ) ;
+
+	/**
+	 * The load function that reads the whole of the given file, such as a program source file, into memory.
+	 * Returns the contents, which the caller frees, and sets their length, or returns NULL if there is not enough memory.
+	 */
+	char * bf_file_load ( FILE * , long long * ) ;
+
+	/**
+	 * The file read function that reads whatever input is available from the given file, without waiting for a full buffer, for use as the read function of a run.
+	 * Returns the number of bytes read, 0 at the end of the file, or -1 if the file could not be read.
+	 */
+	long long bf_file_read ( void * , uint8_t * , long long ) ;
+
+	/**
+	 * The file write function that writes output to the given file, for use as the write function of a run.
+	 * Returns the number of bytes written.
+	 */
+	long long bf_file_write ( void * , const uint8_t * , long long ) ;
+
+	/**
+	 * The map function that maps the given file into memory, if it is a regular file, for use as the whole input of a run.
+	 * Returns the mapping, or NULL if the file cannot be mapped and has to be read.
+	 */
+	const uint8_t * bf_file_map ( FILE * , long long * ) ;
+
+	/**
+	 * The unmap function that removes a mapping made by the map function.
+	 */
+	void bf_file_unmap ( const uint8_t * , long long ) ;
+
+	/**
+	 * The terminal function that tells whether the given file is shown on a terminal, for the terminal flag of a run.
+	 */
+	int bf_file_terminal ( FILE * ) ;
+
+	/**
+	 * The cleanup function that frees a compiled program.
+	 */
+	void bf_program_destroy ( struct bf_program * ) ;
+
+	/**
+	 * The cleanup function that frees a context.
+	 */
+	void bf_context_destroy ( struct bf_context * ) ;
+
+#endif
@@ -0,0 +1,6 @@
+TEMPLATE = lib
+CONFIG += staticlib
+TARGET = bf
+SOURCES += libbf.c program.c prefix.c bounds.c scan.c jit.c io.c profile.c
+HEADERS += libbf.h
+QMAKE_CFLAGS += -Wall -Wextra -Wshadow -pedantic -Werror -std=c99
\ No newline at end of file
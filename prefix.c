@@ -0,0 +1,245 @@
+/**
+ * Brainfuck Prefix Evaluator
+ *
+ * Runs the start of the program when it is compiled, since everything before the first input does the same work on every run, such as building tables of constants.
+ * The prefix only ever ends before a top level instruction, so the instructions left after it are still a whole program on their own.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include "struct.h"
+# include "prefix.h"
+
+/**
+ * The cell function that finds the cell at the given offset from the pointer, growing the list if the cell is outside it.
+ * Returns the first byte of the cell, or NULL if the list would grow past its limit or there is not enough memory.
+ */
+uint8_t * prefix_cell ( struct prefix_state * state , long long offset ) {
+	long long index = state -> list . position + offset ;
+	int width = state -> list . width ;
+	while ( ( index < 0 ) || ( index >= state -> list . size ) ) {													//Double the list until the cell is within it.
+		long long size = state -> list . size ;
+		uint8_t * cells ;
+		if ( 2 * size > PREFIX_LIST_MAXIMUM ) {
+			return NULL ;
+		}
+		cells = ( uint8_t * ) calloc ( 2 * size , width ) ;
+		if ( cells == NULL ) {
+			return NULL ;
+		}
+		if ( index < 0 ) {																							//Check if the list has to grow before the first cell, and move the current cells after the new ones.
+			memcpy ( cells + size * width , state -> list . cells , size * width ) ;
+			state -> list . position += size ;
+			state -> list . origin += size ;
+			index += size ;
+		}
+		else {
+			memcpy ( cells , state -> list . cells , size * width ) ;
+		}
+		free ( state -> list . cells ) ;
+		state -> list . cells = cells ;
+		state -> list . size = 2 * size ;
+	}
+	return state -> list . cells + index * width ;
+}
+
+/**
+ * The load function that reads a cell of the given width.
+ * Returns the value of the cell.
+ */
+uint32_t prefix_load ( const uint8_t * cell , int width ) {
+	switch ( width ) {
+		case 1 : return * cell ;
+		case 2 : return * ( const uint16_t * ) cell ;
+		default : return * ( const uint32_t * ) cell ;
+	}
+}
+
+/**
+ * The store function that writes a value to a cell of the given width, wrapped around to the width.
+ */
+void prefix_store ( uint8_t * cell , int width , uint32_t value ) {
+	switch ( width ) {
+		case 1 : * cell = ( uint8_t ) value ; break ;
+		case 2 : * ( uint16_t * ) cell = ( uint16_t ) value ; break ;
+		default : * ( uint32_t * ) cell = value ; break ;
+	}
+}
+
+/**
+ * The output function that adds a value to the output of the prefix.
+ * Returns 1 ( true ) if it was added, or 0 ( false ) if the output would grow past its limit or there is not enough memory.
+ */
+int prefix_output ( struct prefix_state * state , uint8_t value ) {
+	if ( state -> output_length == state -> output_capacity ) {														//Check if the output is full, and double it.
+		long long capacity = ( state -> output_capacity == 0 ) ? PROGRAM_IO_BUFFER_SIZE : 2 * state -> output_capacity ;
+		uint8_t * output ;
+		if ( capacity > PREFIX_OUTPUT_MAXIMUM ) {
+			return 0 ;
+		}
+		output = ( uint8_t * ) realloc ( state -> output , capacity ) ;
+		if ( output == NULL ) {
+			return 0 ;
+		}
+		state -> output = output ;
+		state -> output_capacity = capacity ;
+	}
+	state -> output [ state -> output_length ++ ] = value ;
+	return 1 ;
+}
+
+/**
+ * The run function that runs the instructions from the start on cells of the given width, until the given number have run, an input or the end is reached, or the list or output grow past their limits.
+ * Sets the index of the last top level instruction reached, along with the number of instructions run before it.
+ */
+void prefix_run ( const struct program_code * code , const uint8_t * top , int width , long long limit , struct prefix_state * state , long long * boundary , long long * boundary_executed ) {
+	state -> list . size = PROGRAM_LIST_INITIAL_SIZE ;
+	state -> list . width = width ;
+	state -> list . cells = ( uint8_t * ) calloc ( state -> list . size , width ) ;
+	state -> list . position = 0 ;
+	state -> list . origin = 0 ;
+	state -> output = NULL ;
+	state -> output_length = 0 ;
+	state -> output_capacity = 0 ;
+	state -> executed = 0 ;
+	state -> failed = ( state -> list . cells == NULL ) ;
+	* boundary = 0 ;
+	* boundary_executed = 0 ;
+	for ( state -> counter = 0 ; ( ! state -> failed ) && ( state -> counter < code -> length ) ; state -> counter ++ ) {
+		const struct program_instruction * instruction = & code -> instructions [ state -> counter ] ;
+		uint8_t * cell ;
+		if ( top [ state -> counter ] ) {																			//Remember the last top level instruction, where the prefix can end.
+			* boundary = state -> counter ;
+			* boundary_executed = state -> executed ;
+		}
+		if ( ( instruction -> operation == OPERATION_INPUT ) || ( state -> executed == limit ) ) {					//Stop before the first input, which the prefix cannot know, or once the budget is spent.
+			return ;
+		}
+		switch ( instruction -> operation ) {																		//Perform the instruction as the library would, stopping if a cell cannot be reached.
+			case OPERATION_ADD :
+				if ( ( cell = prefix_cell ( state , instruction -> offset ) ) != NULL ) {
+					prefix_store ( cell , width , prefix_load ( cell , width ) + ( uint32_t ) instruction -> argument ) ;
+				}
+				break ;
+			case OPERATION_SET :
+				if ( ( cell = prefix_cell ( state , instruction -> offset ) ) != NULL ) {
+					prefix_store ( cell , width , ( uint32_t ) instruction -> argument ) ;
+				}
+				break ;
+			case OPERATION_MULTIPLY :
+				if ( ( cell = prefix_cell ( state , instruction -> offset ) ) != NULL ) {							//Read the cell before the list is possibly grown.
+					uint32_t value = prefix_load ( cell , width ) * ( uint32_t ) instruction -> argument ;
+					if ( ( cell = prefix_cell ( state , instruction -> offset + instruction -> distance ) ) != NULL ) {
+						prefix_store ( cell , width , prefix_load ( cell , width ) + value ) ;
+					}
+				}
+				break ;
+			case OPERATION_MOVE :
+				state -> list . position += instruction -> argument ;
+				cell = prefix_cell ( state , 0 ) ;
+				break ;
+			case OPERATION_SCAN :
+				while ( ( ( cell = prefix_cell ( state , 0 ) ) != NULL ) && ( prefix_load ( cell , width ) != 0 ) ) {
+					state -> list . position += instruction -> argument ;
+				}
+				break ;
+			case OPERATION_OUTPUT :
+				if ( ( ( cell = prefix_cell ( state , instruction -> offset ) ) != NULL ) && ( ! prefix_output ( state , ( uint8_t ) prefix_load ( cell , width ) ) ) ) {
+					cell = NULL ;
+				}
+				break ;
+			case OPERATION_LOOP_START :
+				if ( ( ( cell = prefix_cell ( state , 0 ) ) != NULL ) && ( prefix_load ( cell , width ) == 0 ) ) {	//Skip to the end of the loop if the cell holds 0.
+					state -> counter = instruction -> jump ;
+				}
+				break ;
+			case OPERATION_LOOP_END :
+				if ( ( ( cell = prefix_cell ( state , 0 ) ) != NULL ) && ( prefix_load ( cell , width ) != 0 ) ) {	//Go back to the start of the loop if the cell does not hold 0.
+					state -> counter = instruction -> jump ;
+				}
+				break ;
+			default : cell = state -> list . cells ; break ;
+		}
+		state -> failed = ( cell == NULL ) ;
+		state -> executed ++ ;
+	}
+	if ( ! state -> failed ) {																						//The whole program ran without any input.
+		* boundary = code -> length ;
+		* boundary_executed = state -> executed ;
+	}
+}
+
+void prefix_evaluate ( struct program_details * details ) {
+	struct program_code * code = & details -> code ;
+	struct program_prefix * prefix = & details -> prefix ;
+	struct prefix_state state ;
+	long long index , depth = 0 , boundary , boundary_executed , low , high ;
+	int width = 1 << details -> options . cell ;
+	uint8_t * top ;
+	memset ( prefix , 0 , sizeof ( struct program_prefix ) ) ;
+	if ( ( details -> options . prefix_budget <= 0 ) || ( code -> length == 0 ) ) {
+		return ;
+	}
+	top = ( uint8_t * ) malloc ( code -> length * sizeof ( uint8_t ) ) ;											//Mark the instructions outside any loop, where the prefix can end.
+	if ( top == NULL ) {
+		return ;
+	}
+	for ( index = 0 ; index < code -> length ; index ++ ) {
+		top [ index ] = ( depth == 0 ) ;
+		if ( code -> instructions [ index ] . operation == OPERATION_LOOP_START ) {
+			depth ++ ;
+		}
+		else if ( code -> instructions [ index ] . operation == OPERATION_LOOP_END ) {
+			depth -- ;
+		}
+	}
+	prefix_run ( code , top , width , details -> options . prefix_budget , & state , & boundary , & boundary_executed ) ;
+	if ( ( state . failed || ( state . counter != boundary ) ) && ( boundary != 0 ) ) {								//Check if the prefix stopped within a loop, and run it again to stop at the last top level instruction instead.
+		free ( state . list . cells ) ;
+		free ( state . output ) ;
+		prefix_run ( code , top , width , boundary_executed , & state , & boundary , & boundary_executed ) ;
+	}
+	free ( top ) ;
+	if ( state . failed || ( boundary == 0 ) ) {																	//Check if nothing could be run, and leave the program as it is.
+		free ( state . list . cells ) ;
+		free ( state . output ) ;
+		return ;
+	}
+	for ( low = 0 ; ( low < state . list . position ) && ( prefix_load ( state . list . cells + low * width , width ) == 0 ) ; low ++ ) ;	//Keep only the cells from the lowest to the highest that do not hold 0, along with the one under the pointer.
+	for ( high = state . list . size - 1 ; ( high > state . list . position ) && ( prefix_load ( state . list . cells + high * width , width ) == 0 ) ; high -- ) ;
+	prefix -> length = high - low + 1 ;
+	prefix -> cells = ( uint8_t * ) malloc ( prefix -> length * width ) ;
+	if ( prefix -> cells == NULL ) {
+		free ( state . list . cells ) ;
+		free ( state . output ) ;
+		memset ( prefix , 0 , sizeof ( struct program_prefix ) ) ;
+		return ;
+	}
+	memcpy ( prefix -> cells , state . list . cells + low * width , prefix -> length * width ) ;
+	free ( state . list . cells ) ;
+	prefix -> position = state . list . position - low ;
+	prefix -> origin = state . list . origin - low ;
+	prefix -> output = state . output ;
+	prefix -> output_length = state . output_length ;
+	prefix -> executed = boundary_executed ;
+	prefix -> removed = boundary ;
+	memmove ( code -> instructions , code -> instructions + boundary , ( code -> length - boundary ) * sizeof ( struct program_instruction ) ) ;	//Take the instructions that were run from the start of the program.
+	code -> length -= boundary ;
+	for ( index = 0 ; index < code -> length ; index ++ ) {															//Move the jumps of the loops along with them.
+		if ( ( code -> instructions [ index ] . operation == OPERATION_LOOP_START ) || ( code -> instructions [ index ] . operation == OPERATION_LOOP_END ) ) {
+			code -> instructions [ index ] . jump -= boundary ;
+		}
+	}
+}
+
+void prefix_clean ( struct program_prefix * prefix ) {
+	free ( prefix -> cells ) ;
+	free ( prefix -> output ) ;
+	memset ( prefix , 0 , sizeof ( struct program_prefix ) ) ;
+}
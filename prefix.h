@@ -0,0 +1,18 @@
+# ifndef BRAINF_PREFIX_FILE
+	# define BRAINF_PREFIX_FILE 0
+
+	# include "struct.h"
+
+	/**
+	 * The evaluation function that runs the start of the program instructions, up to the first input or the instruction budget of the options, and keeps the program list and output it leaves in the prefix of the program details.
+	 * The instructions that were run are taken from the start of the program, so that every run starts from the prefix instead.
+	 * If there is not enough memory, the program is left as it is.
+	 */
+	void prefix_evaluate ( struct program_details * ) ;
+
+	/**
+	 * The cleanup function that frees the program list and output of a prefix.
+	 */
+	void prefix_clean ( struct program_prefix * ) ;
+
+#endif
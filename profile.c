@@ -0,0 +1,228 @@
+/**
+ * Brainfuck Execution Profiler
+ *
+ * Counts how often every instruction and loop of the program is executed by the interpreter engine, and reports where the time goes.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include "struct.h"
+# include "profile.h"
+
+# define PROFILE_SNIPPET_LENGTH 48																					//The most commands of a loop shown in the profile report.
+
+/**
+ * The names of the operations, in the order of the operation enumeration.
+ */
+const char * profile_operations [ ] = { "add" , "move" , "output" , "input" , "loop start" , "loop end" , "set" , "multiply" , "scan" , "guard" } ;
+
+int profile_init ( struct program_profile * profile , const struct program_code * code ) {
+	long long index ;
+	profile -> loop_count = 0 ;
+	profile -> low = 0 ;
+	profile -> high = 0 ;
+	profile -> loops = NULL ;
+	profile -> counts = ( long long * ) calloc ( code -> length + 1 , sizeof ( long long ) ) ;						//Create the instruction counters, all set to 0.
+	profile -> loop_index = ( long long * ) malloc ( ( code -> length + 1 ) * sizeof ( long long ) ) ;
+	if ( ( profile -> counts == NULL ) || ( profile -> loop_index == NULL ) ) {
+		return 0 ;																									//Return 0 ( false ) as there is not enough memory.
+	}
+	for ( index = 0 ; index < code -> length ; index ++ ) {															//Count the loops, to know how many loop counters are needed.
+		if ( code -> instructions [ index ] . operation == OPERATION_LOOP_START ) {
+			profile -> loop_count ++ ;
+		}
+	}
+	profile -> loops = ( struct profile_loop * ) calloc ( profile -> loop_count + 1 , sizeof ( struct profile_loop ) ) ;
+	if ( profile -> loops == NULL ) {
+		return 0 ;
+	}
+	profile -> loop_count = 0 ;
+	for ( index = 0 ; index < code -> length ; index ++ ) {															//Number the loops in the order they start, giving both ends of a loop its number.
+		const struct program_instruction * instruction = & code -> instructions [ index ] ;
+		if ( instruction -> operation == OPERATION_LOOP_START ) {
+			profile -> loops [ profile -> loop_count ] . start = index ;
+			profile -> loop_index [ index ] = profile -> loop_count ++ ;
+		}
+		else if ( instruction -> operation == OPERATION_LOOP_END ) {
+			profile -> loop_index [ index ] = profile -> loop_index [ instruction -> jump ] ;
+		}
+		else {
+			profile -> loop_index [ index ] = -1 ;
+		}
+	}
+	return 1 ;
+}
+
+void profile_loop_end ( struct profile_loop * loop ) {
+	long long iterations = loop -> current ;
+	int bucket = 0 ;
+	while ( ( iterations > 0 ) && ( bucket < PROFILE_HISTOGRAM_SIZE - 1 ) ) {										//Find the bucket from the number of bits in the number of iterations.
+		iterations >>= 1 ;
+		bucket ++ ;
+	}
+	loop -> histogram [ bucket ] ++ ;
+	loop -> iterations += loop -> current ;
+	loop -> current = 0 ;
+}
+
+/**
+ * The cost function that finds the number of instructions executed within every loop, from the running total of the instruction counters.
+ * Returns the total number of instructions executed.
+ */
+long long profile_costs ( struct program_profile * profile , const struct program_code * code ) {
+	long long * totals = ( long long * ) malloc ( ( code -> length + 1 ) * sizeof ( long long ) ) ;					//The number of instructions executed before each instruction, in program order.
+	long long index , total = 0 ;
+	for ( index = 0 ; index < code -> length ; index ++ ) {
+		if ( totals != NULL ) {
+			totals [ index ] = total ;
+		}
+		total += profile -> counts [ index ] ;
+	}
+	for ( index = 0 ; ( totals != NULL ) && ( index < profile -> loop_count ) ; index ++ ) {						//A loop costs every instruction from its start to its end.
+		struct profile_loop * loop = & profile -> loops [ index ] ;
+		long long end = code -> instructions [ loop -> start ] . jump ;
+		loop -> cost = totals [ end ] + profile -> counts [ end ] - totals [ loop -> start ] ;
+	}
+	free ( totals ) ;
+	return total ;
+}
+
+/**
+ * The comparison function that orders loops from the most to the least instructions executed within them.
+ */
+int profile_compare ( const void * first , const void * second ) {
+	long long difference = ( * ( struct profile_loop * const * ) second ) -> cost - ( * ( struct profile_loop * const * ) first ) -> cost ;
+	return ( difference > 0 ) - ( difference < 0 ) ;
+}
+
+/**
+ * The snippet function that writes the commands of the source between the given byte positions, leaving out the comments.
+ */
+void profile_snippet ( FILE * out , const char * source , long long length , long long start , long long end ) {
+	long long index , shown = 0 ;
+	for ( index = start - 1 ; ( index < end ) && ( index < length ) ; index ++ ) {									//The positions count from 1.
+		if ( ( source [ index ] == '\0' ) || ( strchr ( "><+-.,[]" , source [ index ] ) == NULL ) ) {
+			continue ;
+		}
+		if ( shown == PROFILE_SNIPPET_LENGTH ) {																	//Cut the loop short if it is too long to show.
+			fprintf ( out , " ..." ) ;
+			return ;
+		}
+		fputc ( source [ index ] , out ) ;
+		shown ++ ;
+	}
+}
+
+/**
+ * The histogram function that writes the buckets of a loop iteration histogram which hold any entries.
+ */
+void profile_histogram ( FILE * out , struct profile_loop * loop ) {
+	int bucket ;
+	for ( bucket = 0 ; bucket < PROFILE_HISTOGRAM_SIZE ; bucket ++ ) {
+		long long low = ( bucket == 0 ) ? 0 : 1LL << ( bucket - 1 ) ;
+		if ( loop -> histogram [ bucket ] == 0 ) {
+			continue ;
+		}
+		if ( bucket == PROFILE_HISTOGRAM_SIZE - 1 ) {																//The last bucket holds every larger number of iterations.
+			fprintf ( out , " %lld+ x%lld" , low , loop -> histogram [ bucket ] ) ;
+		}
+		else if ( bucket <= 1 ) {
+			fprintf ( out , " %lld x%lld" , low , loop -> histogram [ bucket ] ) ;
+		}
+		else {
+			fprintf ( out , " %lld-%lld x%lld" , low , 2 * low - 1 , loop -> histogram [ bucket ] ) ;
+		}
+	}
+}
+
+void profile_report ( struct program_profile * profile , const struct program_code * code , const char * source , long long source_length , FILE * out ) {
+	long long totals [ OPERATION_GUARD + 1 ] = { 0 } ;
+	long long index , total ;
+	struct profile_loop * * hottest ;
+	total = profile_costs ( profile , code ) ;
+	for ( index = 0 ; index < code -> length ; index ++ ) {															//Sum the counters of the instructions by operation.
+		totals [ code -> instructions [ index ] . operation ] += profile -> counts [ index ] ;
+	}
+	fprintf ( out , "\n\n------------------" ) ;
+	fprintf ( out , "\nPROFILE" ) ;
+	fprintf ( out , "\nInstructions executed : %lld" , total ) ;
+	fprintf ( out , "\nTape extent : cells %lld to %lld ( %lld cells )" , profile -> low , profile -> high , profile -> high - profile -> low + 1 ) ;
+	fprintf ( out , "\nOperations :" ) ;
+	for ( index = 0 ; index <= OPERATION_GUARD ; index ++ ) {
+		if ( totals [ index ] != 0 ) {
+			fprintf ( out , "\n\t%-12s %16lld ( %5.1f%% )" , profile_operations [ index ] , totals [ index ] , 100.0 * totals [ index ] / total ) ;
+		}
+	}
+	hottest = ( struct profile_loop * * ) malloc ( ( profile -> loop_count + 1 ) * sizeof ( struct profile_loop * ) ) ;
+	if ( ( hottest != NULL ) && ( profile -> loop_count != 0 ) ) {													//Sort the loops by the instructions executed within them, and show the hottest.
+		for ( index = 0 ; index < profile -> loop_count ; index ++ ) {
+			hottest [ index ] = & profile -> loops [ index ] ;
+		}
+		qsort ( hottest , profile -> loop_count , sizeof ( struct profile_loop * ) , profile_compare ) ;
+		fprintf ( out , "\nHottest loops :" ) ;
+		for ( index = 0 ; ( index < profile -> loop_count ) && ( index < PROFILE_REPORT_LOOPS ) && ( hottest [ index ] -> cost != 0 ) ; index ++ ) {
+			struct profile_loop * loop = hottest [ index ] ;
+			const struct program_instruction * start = & code -> instructions [ loop -> start ] ;
+			fprintf ( out , "\n\tByte %lld : %lld instructions ( %.1f%% ) , %lld entries , %lld iterations ( %.1f per entry )" ,
+				start -> position , loop -> cost , 100.0 * loop -> cost / total , loop -> entries , loop -> iterations ,
+				loop -> entries ? ( double ) loop -> iterations / loop -> entries : 0.0 ) ;
+			fprintf ( out , "\n\t\tIterations :" ) ;
+			profile_histogram ( out , loop ) ;
+			if ( source != NULL ) {
+				fprintf ( out , "\n\t\tSource : " ) ;
+				profile_snippet ( out , source , source_length , start -> position , code -> instructions [ start -> jump ] . position ) ;
+			}
+		}
+	}
+	fprintf ( out , "\n------------------\n\n" ) ;
+	free ( hottest ) ;
+}
+
+int profile_dump ( struct program_profile * profile , const struct program_code * code , const char * dump_file ) {
+	FILE * dump = fopen ( dump_file , "w" ) ;
+	long long index , total , written = 0 ;
+	int bucket ;
+	if ( dump == NULL ) {
+		return 0 ;																									//Return 0 ( false ) as the file could not be opened.
+	}
+	total = profile_costs ( profile , code ) ;
+	fprintf ( dump , "{\n\t\"executed\" : %lld ,\n\t\"tape_low\" : %lld ,\n\t\"tape_high\" : %lld ,\n\t\"instructions\" : [" , total , profile -> low , profile -> high ) ;
+	for ( index = 0 ; index < code -> length ; index ++ ) {															//Write the counter of every instruction, along with its byte position in the source.
+		const struct program_instruction * instruction = & code -> instructions [ index ] ;
+		if ( instruction -> operation == OPERATION_GUARD ) {														//Leave out the guards, which are not instructions of the program and are never counted.
+			continue ;
+		}
+		fprintf ( dump , "%s\n\t\t{ \"index\" : %lld , \"position\" : %lld , \"operation\" : \"%s\" , \"count\" : %lld }" , written ++ ? " ," : "" ,
+			index , instruction -> position , profile_operations [ instruction -> operation ] , profile -> counts [ index ] ) ;
+	}
+	fprintf ( dump , "\n\t] ,\n\t\"loops\" : [" ) ;
+	for ( index = 0 ; index < profile -> loop_count ; index ++ ) {													//Write the counters of every loop, along with the byte positions of both its ends.
+		struct profile_loop * loop = & profile -> loops [ index ] ;
+		const struct program_instruction * start = & code -> instructions [ loop -> start ] ;
+		fprintf ( dump , "%s\n\t\t{ \"position\" : %lld , \"end\" : %lld , \"entries\" : %lld , \"iterations\" : %lld , \"cost\" : %lld , \"histogram\" : [" ,
+			index ? " ," : "" , start -> position , code -> instructions [ start -> jump ] . position , loop -> entries , loop -> iterations , loop -> cost ) ;
+		for ( bucket = 0 ; bucket < PROFILE_HISTOGRAM_SIZE ; bucket ++ ) {
+			fprintf ( dump , "%s %lld" , bucket ? " ," : "" , loop -> histogram [ bucket ] ) ;
+		}
+		fprintf ( dump , " ] }" ) ;
+	}
+	fprintf ( dump , "\n\t]\n}\n" ) ;
+	fclose ( dump ) ;
+	return 1 ;
+}
+
+void profile_clean ( struct program_profile * profile ) {
+	free ( profile -> counts ) ;
+	free ( profile -> loop_index ) ;
+	free ( profile -> loops ) ;
+	profile -> counts = NULL ;
+	profile -> loop_index = NULL ;
+	profile -> loops = NULL ;
+	profile -> loop_count = 0 ;
+}
@@ -0,0 +1,34 @@
+# ifndef BRAINF_PROFILE_FILE
+	# define BRAINF_PROFILE_FILE 0
+
+	# include <stdio.h>
+	# include "struct.h"
+
+	/**
+	 * The initializer function that sets up the counters for the program instructions and finds the loops of the program.
+	 * Returns 1 ( true ) if the counters were set up, or 0 ( false ) if there is not enough memory.
+	 */
+	int profile_init ( struct program_profile * , const struct program_code * ) ;
+
+	/**
+	 * The loop function that records the number of iterations of a loop that has just ended.
+	 */
+	void profile_loop_end ( struct profile_loop * ) ;
+
+	/**
+	 * The report function that writes the hottest loops of the program, along with their commands from the given program source, and the totals of every operation.
+	 */
+	void profile_report ( struct program_profile * , const struct program_code * , const char * , long long , FILE * ) ;
+
+	/**
+	 * The dump function that writes every counter to the given file as JSON.
+	 * Returns 1 ( true ) if the file was written, or 0 ( false ) if it could not be opened.
+	 */
+	int profile_dump ( struct program_profile * , const struct program_code * , const char * ) ;
+
+	/**
+	 * The cleanup function that frees the counters.
+	 */
+	void profile_clean ( struct program_profile * ) ;
+
+#endif
@@ -0,0 +1,307 @@
+/**
+ * Brainfuck Program Loader
+ * 
+ * Loads the program source file into instructions and optimizes them, for the library and the compiler.
+ * Every function works on the program details it is given and returns its errors instead of exiting, so that many programs can be loaded at once.
+ * 
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include "struct.h"
+# include "program.h"
+
+int optimization_option ( struct program_options * options , const char * option ) {
+	if ( ! strncmp ( option , "--optimize=" , 11 ) ) {																//Check if the option sets the optimization level.
+		char * end ;
+		long level = strtol ( option + 11 , & end , 10 ) ;															//Read the level given after the option name.
+		if ( ( end == option + 11 ) || ( * end != '\0' ) || ( level < 0 ) || ( level > OPTIMIZATION_LEVEL_MAXIMUM ) ) {	//Check if the level is not a valid number.
+			return 0 ;
+		}
+		options -> optimization_level = ( int ) level ;
+		return 1 ;
+	}
+	if ( ! strncmp ( option , "--prefix=" , 9 ) ) {																	//Check if the option sets the budget of the prefix run when the program is compiled.
+		char * end ;
+		long long budget = strtoll ( option + 9 , & end , 10 ) ;
+		if ( ( end == option + 9 ) || ( * end != '\0' ) || ( budget < 0 ) ) {
+			return 0 ;
+		}
+		options -> prefix_budget = budget ;
+		return 1 ;
+	}
+	return 0 ;																										//Return 0 ( false ) as the option is not an optimization option.
+}
+
+int program_error ( struct program_details * details , int status , const char * message ) {
+	strcpy ( details -> file . message , message ) ;
+	details -> file . status = status ;
+	return 0 ;																										//Return 0 ( false ) so the caller can return it straight away.
+}
+
+char * program_read ( FILE * file , long long * length ) {
+	char * source = NULL ;																							//The buffer into which the whole program source file is read.
+	long long capacity = 0 ;
+	size_t read ;
+	* length = 0 ;
+	do {
+		if ( * length == capacity ) {																				//Check if the source buffer is full.
+			char * grown ;
+			capacity = capacity ? capacity * 2 : 65536 ;															//Double the size of the source buffer.
+			grown = ( char * ) realloc ( source , capacity ) ;
+			if ( grown == NULL ) {																					//Check if the source buffer could not be allocated.
+				free ( source ) ;
+				return NULL ;
+			}
+			source = grown ;
+		}
+		read = fread ( source + * length , 1 , capacity - * length , file ) ;										//Read as much of the program source file as fits in the source buffer.
+		* length += read ;
+	} while ( read != 0 ) ;
+	return source ;
+}
+
+int program_load ( struct program_details * details , const char * source , long long source_length ) {
+	long long commands = 0 , loops = 0 , depth = 0 , index ;
+	for ( index = 0 ; index < source_length ; index ++ ) {															//Count the commands and loops in the program, skipping the comments.
+		if ( ( source [ index ] != '\0' ) && ( strchr ( "><+-.,[]" , source [ index ] ) != NULL ) ) {
+			commands ++ ;
+		}
+		if ( source [ index ] == '[' ) {
+			loops ++ ;
+		}
+	}
+	details -> code . instructions = ( struct program_instruction * )
+		malloc ( ( commands + 1 ) * sizeof ( struct program_instruction ) ) ;										//Create the program instructions array.
+	long long * loop_starts = ( long long * ) malloc ( ( loops + 1 ) * sizeof ( long long ) ) ;						//Create a stack of the loops started but not yet ended, to match the loops with.
+	details -> code . length = 0 ;
+	if ( ( details -> code . instructions == NULL ) || ( loop_starts == NULL ) ) {									//Check if the arrays could not be allocated.
+		free ( loop_starts ) ;
+		return program_error ( details , -5 , "Not enough memory to load the source file." ) ;						//We have hit an unrecoverable error. Set error status and message and return it.
+	}
+	for ( index = 0 ; index < source_length ; index ++ ) {															//Go through the program source and build the instructions.
+		struct program_instruction * instruction = & details -> code . instructions [ details -> code . length ] ;
+		instruction -> argument = 0 ;
+		instruction -> offset = 0 ;
+		instruction -> distance = 0 ;
+		switch ( source [ index ] ) {
+			case '>' : instruction -> operation = OPERATION_MOVE ; instruction -> argument = 1 ; break ;			//Every command is loaded as a single instruction.
+			case '<' : instruction -> operation = OPERATION_MOVE ; instruction -> argument = -1 ; break ;
+			case '+' : instruction -> operation = OPERATION_ADD ; instruction -> argument = 1 ; break ;
+			case '-' : instruction -> operation = OPERATION_ADD ; instruction -> argument = -1 ; break ;
+			case '.' : instruction -> operation = OPERATION_OUTPUT ; break ;
+			case ',' : instruction -> operation = OPERATION_INPUT ; break ;
+			case '[' : instruction -> operation = OPERATION_LOOP_START ;
+					   loop_starts [ depth ++ ] = details -> code . length ; break ;								//Push the start of the loop on to the loop stack.
+			case ']' : instruction -> operation = OPERATION_LOOP_END ;
+					   if ( depth == 0 ) {																			//Check if there is no started loop to be ended.
+						   details -> file . pointer . position = index + 1 ;
+						   free ( loop_starts ) ;
+						   return program_error ( details , -4 , "Unmatched end loop encountered." ) ;				//We have hit an unrecoverable error. Set error status and message and return it.
+					   }
+					   instruction -> jump = loop_starts [ -- depth ] ;												//Pop the start of the loop and link both ends of the loop to each other.
+					   details -> code . instructions [ instruction -> jump ] . jump = details -> code . length ;
+					   break ;
+			default : continue ;																					//Skip every other character because it is treated as a comment.
+		}
+		instruction -> position = index + 1 ;																		//Store the position of the command in the program source.
+		details -> code . length ++ ;
+	}
+	if ( depth != 0 ) {																								//Check if there is a started loop which was never ended.
+		details -> file . pointer . position = details -> code . instructions [ loop_starts [ depth - 1 ] ] . position ;
+		free ( loop_starts ) ;
+		return program_error ( details , -3 , "Unmatched start loop encountered." ) ;								//We have hit an unrecoverable error. Set error status and message and return it.
+	}
+	free ( loop_starts ) ;																							//Free the loop stack since the instructions have been built.
+	return 1 ;
+}
+
+/**
+ * The loop optimizer function that replaces a loop which only adds and moves with straight instructions, if possible.
+ * Returns 1 ( true ) if the loop was replaced.
+ */
+int optimize_loop ( struct program_details * details , struct program_instruction * loaded , long long start , struct program_instruction * optimized , long long * count ) {
+	long long end = loaded [ start ] . jump , index , offset = 0 , change = 0 , moves = 0 , first = * count , target ;
+	for ( index = start + 1 ; index < end ; index ++ ) {															//Go through the loop body to find how it changes the list.
+		if ( loaded [ index ] . operation == OPERATION_MOVE ) {
+			offset += loaded [ index ] . argument ;
+			moves ++ ;
+		}
+		else if ( loaded [ index ] . operation == OPERATION_ADD ) {
+			if ( offset == 0 ) {
+				change += loaded [ index ] . argument ;																//Sum the change to the cell the loop checks.
+			}
+		}
+		else {
+			return 0 ;																								//Return 0 ( false ) as the loop does more than adding and moving.
+		}
+	}
+	if ( ( offset != 0 ) && ( moves == end - start - 1 ) ) {														//Check if the loop only moves the pointer, which makes it a scan loop.
+		optimized [ * count ] = loaded [ start ] ;
+		optimized [ * count ] . operation = OPERATION_SCAN ;
+		optimized [ * count ] . argument = offset ;
+		( * count ) ++ ;
+		return 1 ;
+	}
+	if ( ( offset != 0 ) || ( change % 2 == 0 ) ) {																	//Check if the loop moves the pointer, or may never reach 0 since it changes the checked cell by an even amount.
+		return 0 ;
+	}
+	if ( moves != 0 ) {																								//Check if the loop changes other cells, which makes it a multiplication loop.
+		if ( ( details -> options . optimization_level < 2 ) || ( ( change != 1 ) && ( change != -1 ) ) ) {			//Check if multiplication loops are not to be optimized, or the number of iterations is not the checked cell's value.
+			return 0 ;
+		}
+		for ( index = start + 1 ; index < end ; index ++ ) {														//Go through the loop body again and build a multiplication for every other cell changed.
+			if ( loaded [ index ] . operation == OPERATION_MOVE ) {
+				offset += loaded [ index ] . argument ;
+			}
+			else if ( offset != 0 ) {
+				for ( target = first ; target < * count ; target ++ ) {												//Find the multiplication of the cell, if it was already built.
+					if ( optimized [ target ] . distance == offset ) {
+						break ;
+					}
+				}
+				if ( target == * count ) {																			//Build a new multiplication since the cell has not been changed before.
+					optimized [ target ] = loaded [ start ] ;
+					optimized [ target ] . operation = OPERATION_MULTIPLY ;
+					optimized [ target ] . argument = 0 ;
+					optimized [ target ] . distance = offset ;
+					( * count ) ++ ;
+				}
+				optimized [ target ] . argument -= change * loaded [ index ] . argument ;							//The loop runs value times when it decrements and -value times when it increments.
+			}
+		}
+		for ( index = target = first ; index < * count ; index ++ ) {												//Drop the multiplications whose changes cancelled out.
+			if ( optimized [ index ] . argument != 0 ) {
+				optimized [ target ++ ] = optimized [ index ] ;
+			}
+		}
+		* count = target ;
+	}
+	optimized [ * count ] = loaded [ start ] ;																		//Every replaced loop ends with the checked cell set to 0.
+	optimized [ * count ] . operation = OPERATION_SET ;
+	optimized [ * count ] . argument = 0 ;
+	( * count ) ++ ;
+	return 1 ;
+}
+
+/**
+ * The deferral function that removes the pointer movements within straight instructions, giving every instruction the offset of its cell instead.
+ * The total movement is made once, just before the next loop instruction.
+ * Returns 1 ( true ) if the movements were removed, or 0 ( false ) if there is not enough memory.
+ */
+int defer_program_moves ( struct program_details * details ) {
+	struct program_instruction * instructions = details -> code . instructions ;
+	long long length = details -> code . length , count = 0 , depth = 0 , pending = 0 , block = 0 , index ;
+	long long * loop_starts = ( long long * ) malloc ( ( length + 1 ) * sizeof ( long long ) ) ;					//Create a stack of the loops started but not yet ended, to link the loops again.
+	if ( loop_starts == NULL ) {																					//Check if the stack could not be allocated.
+		return program_error ( details , -5 , "Not enough memory to optimize the program." ) ;						//We have hit an unrecoverable error. Set error status and message and return it.
+	}
+	for ( index = 0 ; index < length ; index ++ ) {																	//Go through the instructions, rewriting them in place since the result is never longer.
+		struct program_instruction instruction = instructions [ index ] ;
+		struct program_instruction * last = ( count > block ) ? & instructions [ count - 1 ] : NULL ;				//The previous instruction, if it is in the same straight block.
+		switch ( instruction . operation ) {
+			case OPERATION_MOVE :
+				pending += instruction . argument ;																	//Remember the movement instead of making it.
+				continue ;
+			case OPERATION_LOOP_START :
+			case OPERATION_LOOP_END :
+			case OPERATION_SCAN :
+				if ( pending != 0 ) {																				//Make the remembered movement before the loop or scan instruction, which start from the cell at the pointer.
+					instructions [ count ] = instruction ;
+					instructions [ count ] . operation = OPERATION_MOVE ;
+					instructions [ count ] . argument = pending ;
+					count ++ ;
+					pending = 0 ;
+				}
+				if ( instruction . operation == OPERATION_SCAN ) {
+					instruction . offset = 0 ;
+				}
+				else if ( instruction . operation == OPERATION_LOOP_START ) {
+					loop_starts [ depth ++ ] = count ;																//Push the start of the loop on to the loop stack.
+				}
+				else {
+					instruction . jump = loop_starts [ -- depth ] ;													//Pop the start of the loop and link both ends of the loop to each other.
+					instructions [ instruction . jump ] . jump = count ;
+				}
+				instructions [ count ++ ] = instruction ;
+				block = count ;																						//Start a new straight block after the loop instruction.
+				continue ;
+			case OPERATION_ADD :
+				instruction . offset += pending ;
+				if ( ( last != NULL ) && ( last -> offset == instruction . offset )
+					&& ( ( last -> operation == OPERATION_ADD ) || ( last -> operation == OPERATION_SET ) ) ) {		//Check if the instruction can be folded into the previous one, which works on the same cell.
+					last -> argument += instruction . argument ;
+					continue ;
+				}
+				break ;
+			default :
+				instruction . offset += pending ;																	//Perform the instruction on the cell where the pointer would have been.
+				break ;
+		}
+		instructions [ count ++ ] = instruction ;
+	}
+	free ( loop_starts ) ;																							//Free the loop stack. A movement remembered at the end of the program has no effect, so it is never made.
+	details -> code . length = count ;
+	return 1 ;
+}
+
+int program_optimize ( struct program_details * details ) {
+	struct program_instruction * loaded = details -> code . instructions ;											//The instructions as they were loaded.
+	long long length = details -> code . length , count = 0 , depth = 0 , index ;
+	if ( details -> options . optimization_level == 0 ) {															//Check if the program should be run as it was loaded.
+		return 1 ;
+	}
+	struct program_instruction * optimized = ( struct program_instruction * )
+		malloc ( ( length + 1 ) * sizeof ( struct program_instruction ) ) ;											//Create the optimized instructions array, which is never longer than the loaded one.
+	long long * loop_starts = ( long long * ) malloc ( ( length + 1 ) * sizeof ( long long ) ) ;					//Create a stack of the loops started but not yet ended, to link the loops again.
+	if ( ( optimized == NULL ) || ( loop_starts == NULL ) ) {														//Check if the arrays could not be allocated.
+		free ( optimized ) ;
+		free ( loop_starts ) ;
+		return program_error ( details , -5 , "Not enough memory to optimize the program." ) ;						//We have hit an unrecoverable error. Set error status and message and return it.
+	}
+	for ( index = 0 ; index < length ; index ++ ) {																	//Go through the loaded instructions and build the optimized ones.
+		struct program_instruction * instruction = & loaded [ index ] ;
+		struct program_instruction * last = ( count > 0 ) ? & optimized [ count - 1 ] : NULL ;
+		switch ( instruction -> operation ) {
+			case OPERATION_ADD :
+			case OPERATION_MOVE :
+				if ( ( last != NULL ) && ( ( last -> operation == instruction -> operation )
+					|| ( ( last -> operation == OPERATION_SET ) && ( instruction -> operation == OPERATION_ADD ) ) ) ) {	//Check if the instruction can be folded into the previous one.
+					last -> argument += instruction -> argument ;
+					if ( ( last -> argument == 0 ) && ( last -> operation != OPERATION_SET ) ) {					//Drop the previous instruction if the two cancelled out.
+						count -- ;
+					}
+					continue ;
+				}
+				break ;
+			case OPERATION_LOOP_START :
+				if ( optimize_loop ( details , loaded , index , optimized , & count ) ) {							//Check if the loop could be replaced, and skip it if yes.
+					index = instruction -> jump ;
+					continue ;
+				}
+				loop_starts [ depth ++ ] = count ;																	//Push the start of the loop on to the loop stack.
+				break ;
+			case OPERATION_LOOP_END :
+				optimized [ count ] = * instruction ;
+				optimized [ count ] . jump = loop_starts [ -- depth ] ;												//Pop the start of the loop and link both ends of the loop to each other.
+				optimized [ optimized [ count ] . jump ] . jump = count ;
+				count ++ ;
+				continue ;
+			default : break ;
+		}
+		optimized [ count ++ ] = * instruction ;																	//Copy the instruction as it is.
+	}
+	free ( loop_starts ) ;																							//Free the loop stack and use the optimized instructions instead of the loaded ones.
+	free ( loaded ) ;
+	details -> code . instructions = optimized ;
+	details -> code . length = count ;
+	if ( details -> options . optimization_level >= 3 ) {															//Check if pointer movements should be deferred.
+		return defer_program_moves ( details ) ;
+	}
+	return 1 ;
+}
@@ -0,0 +1,38 @@
+# ifndef BRAINF_PROGRAM_FILE
+	# define BRAINF_PROGRAM_FILE 0
+
+	# include <stdint.h>
+	# include <stdio.h>
+	# include "struct.h"
+
+	/**
+	 * The error function that sets the status and message of the given program details.
+	 * Returns 0 ( false ), to be returned by the function which hit the error.
+	 */
+	int program_error ( struct program_details * , int , const char * ) ;
+
+	/**
+	 * The option function that reads the optimization level and prefix budget options, which the interpreter and the compiler share.
+	 * Returns 1 ( true ) if the option was a valid optimization option.
+	 */
+	int optimization_option ( struct program_options * , const char * ) ;
+
+	/**
+	 * The reader function that reads the whole of a program source file into memory.
+	 * Returns the source, which must be freed, or NULL if there is not enough memory.
+	 */
+	char * program_read ( FILE * , long long * ) ;
+
+	/**
+	 * The loader function that builds the program instructions from the program source.
+	 * Returns 1 ( true ) if the instructions were built, or 0 ( false ) with the status and message set otherwise.
+	 */
+	int program_load ( struct program_details * , const char * , long long ) ;
+
+	/**
+	 * The optimizer function that rewrites the loaded program instructions into fewer, larger instructions.
+	 * Returns 1 ( true ) if the instructions were optimized, or 0 ( false ) with the status and message set otherwise.
+	 */
+	int program_optimize ( struct program_details * ) ;
+
+#endif
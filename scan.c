@@ -0,0 +1,197 @@
+/**
+ * Brainfuck Scan Kernels
+ *
+ * Finds the cell holding 0 that a scan loop such as [>], [<] or [>>>>] stops at, a block of cells at a time where the processor allows it.
+ *
+ * @author Sabarna Chakravarty
+ * @license MIT License
+ */
+
+//Header files
+# include <stdint.h>
+# include <string.h>
+# include "scan.h"
+
+# if defined ( __GNUC__ ) && ( defined ( __x86_64__ ) || defined ( __i386__ ) ) && defined ( __SSE2__ )
+	# define SCAN_VECTOR 1																							//Vector kernels are available, since the processor has SSE2.
+	# include <immintrin.h>
+# else
+	# define SCAN_VECTOR 0																							//Only the scalar kernels are available.
+# endif
+
+# define SCAN_SCALAR_CELLS 16																						//The number of cells checked one at a time before a scan switches to a vector kernel.
+
+/**
+ * The flag that tells whether the processor supports AVX2, which scans twice as many cells at a time as SSE2.
+ */
+int scan_avx2 = 0 ;
+
+void scan_init ( ) {
+# if SCAN_VECTOR
+	__builtin_cpu_init ( ) ;																						//Detect the features of the processor the interpreter runs on.
+	scan_avx2 = __builtin_cpu_supports ( "avx2" ) ;
+# endif
+}
+
+# if SCAN_VECTOR
+
+/**
+ * The mask function that fills the candidate masks of a block of the given width for every phase of the stride.
+ * The mask of a phase has a bit set for every cell in the block whose distance from the first or last cell, when scanning backward, is the phase plus a multiple of the stride.
+ */
+void scan_masks ( uint32_t * masks , long long stride , int width , int backward ) {
+	long long phase ;
+	int cell ;
+	for ( phase = 0 ; phase < stride ; phase ++ ) {																	//Build the mask of every phase.
+		masks [ phase ] = 0 ;
+		for ( cell = phase ; cell < width ; cell += stride ) {
+			masks [ phase ] |= ( uint32_t ) 1 << ( backward ? ( width - 1 - cell ) : cell ) ;
+		}
+	}
+}
+
+/**
+ * The forward SSE2 kernel, which checks 16 cells at a time.
+ */
+long long scan_forward_sse2 ( const uint8_t * cells , long long index , long long end , long long stride ) {
+	uint32_t masks [ SCAN_BLOCK_STRIDE_MAXIMUM ] , found ;
+	long long phase = 0 ;																							//The distance from the start of the block to its first candidate cell.
+	__m128i zero = _mm_setzero_si128 ( ) ;
+	scan_masks ( masks , stride , 16 , 0 ) ;
+	for ( ; index + 16 <= end ; index += 16 ) {																		//Go through the list a block at a time.
+		found = ( uint32_t ) _mm_movemask_epi8 ( _mm_cmpeq_epi8 ( _mm_loadu_si128 ( ( const __m128i * ) ( cells + index ) ) , zero ) ) & masks [ phase ] ;	//Find the candidate cells holding 0 in the block.
+		if ( found != 0 ) {
+			return index + __builtin_ctz ( found ) ;																//Return the first of them.
+		}
+		phase = ( ( ( phase - 16 ) % stride ) + stride ) % stride ;													//Move the phase to the next block.
+	}
+	for ( index += phase ; index < end ; index += stride ) {														//Check the cells left after the last whole block one at a time.
+		if ( cells [ index ] == 0 ) {
+			return index ;
+		}
+	}
+	return -1 ;
+}
+
+/**
+ * The backward SSE2 kernel, which checks 16 cells at a time.
+ */
+long long scan_backward_sse2 ( const uint8_t * cells , long long index , long long stride ) {
+	uint32_t masks [ SCAN_BLOCK_STRIDE_MAXIMUM ] , found ;
+	long long phase = 0 ;																							//The distance from the end of the block to its last candidate cell.
+	__m128i zero = _mm_setzero_si128 ( ) ;
+	scan_masks ( masks , stride , 16 , 1 ) ;
+	for ( ; index - 15 >= 0 ; index -= 16 ) {																		//Go through the list a block at a time.
+		found = ( uint32_t ) _mm_movemask_epi8 ( _mm_cmpeq_epi8 ( _mm_loadu_si128 ( ( const __m128i * ) ( cells + index - 15 ) ) , zero ) ) & masks [ phase ] ;	//Find the candidate cells holding 0 in the block.
+		if ( found != 0 ) {
+			return index - 15 + ( 31 - __builtin_clz ( found ) ) ;													//Return the last of them.
+		}
+		phase = ( ( ( phase - 16 ) % stride ) + stride ) % stride ;													//Move the phase to the next block.
+	}
+	for ( index -= phase ; index >= 0 ; index -= stride ) {															//Check the cells left before the last whole block one at a time.
+		if ( cells [ index ] == 0 ) {
+			return index ;
+		}
+	}
+	return -1 ;
+}
+
+/**
+ * The forward AVX2 kernel, which checks 32 cells at a time.
+ */
+__attribute__ ( ( target ( "avx2" ) ) )
+long long scan_forward_avx2 ( const uint8_t * cells , long long index , long long end , long long stride ) {
+	uint32_t masks [ SCAN_BLOCK_STRIDE_MAXIMUM ] , found ;
+	long long phase = 0 ;																							//The distance from the start of the block to its first candidate cell.
+	__m256i zero = _mm256_setzero_si256 ( ) ;
+	scan_masks ( masks , stride , 32 , 0 ) ;
+	for ( ; index + 32 <= end ; index += 32 ) {																		//Go through the list a block at a time.
+		found = ( uint32_t ) _mm256_movemask_epi8 ( _mm256_cmpeq_epi8 ( _mm256_loadu_si256 ( ( const __m256i * ) ( cells + index ) ) , zero ) ) & masks [ phase ] ;	//Find the candidate cells holding 0 in the block.
+		if ( found != 0 ) {
+			return index + __builtin_ctz ( found ) ;																//Return the first of them.
+		}
+		phase = ( ( ( phase - 32 ) % stride ) + stride ) % stride ;													//Move the phase to the next block.
+	}
+	for ( index += phase ; index < end ; index += stride ) {														//Check the cells left after the last whole block one at a time.
+		if ( cells [ index ] == 0 ) {
+			return index ;
+		}
+	}
+	return -1 ;
+}
+
+/**
+ * The backward AVX2 kernel, which checks 32 cells at a time.
+ */
+__attribute__ ( ( target ( "avx2" ) ) )
+long long scan_backward_avx2 ( const uint8_t * cells , long long index , long long stride ) {
+	uint32_t masks [ SCAN_BLOCK_STRIDE_MAXIMUM ] , found ;
+	long long phase = 0 ;																							//The distance from the end of the block to its last candidate cell.
+	__m256i zero = _mm256_setzero_si256 ( ) ;
+	scan_masks ( masks , stride , 32 , 1 ) ;
+	for ( ; index - 31 >= 0 ; index -= 32 ) {																		//Go through the list a block at a time.
+		found = ( uint32_t ) _mm256_movemask_epi8 ( _mm256_cmpeq_epi8 ( _mm256_loadu_si256 ( ( const __m256i * ) ( cells + index - 31 ) ) , zero ) ) & masks [ phase ] ;	//Find the candidate cells holding 0 in the block.
+		if ( found != 0 ) {
+			return index - 31 + ( 31 - __builtin_clz ( found ) ) ;													//Return the last of them.
+		}
+		phase = ( ( ( phase - 32 ) % stride ) + stride ) % stride ;													//Move the phase to the next block.
+	}
+	for ( index -= phase ; index >= 0 ; index -= stride ) {															//Check the cells left before the last whole block one at a time.
+		if ( cells [ index ] == 0 ) {
+			return index ;
+		}
+	}
+	return -1 ;
+}
+
+# endif
+
+long long scan_forward ( const uint8_t * cells , long long index , long long end , long long stride ) {
+	long long checked ;
+	for ( checked = 0 ; ( checked < SCAN_SCALAR_CELLS ) && ( index < end ) ; checked ++ , index += stride ) {		//Check the first few cells one at a time, since most scans stop quickly.
+		if ( cells [ index ] == 0 ) {
+			return index ;
+		}
+	}
+	if ( index >= end ) {																							//Check if there are no cells left to scan.
+		return -1 ;
+	}
+	if ( stride == 1 ) {																							//Use the library search for a single stride, which is vectorized already.
+		const uint8_t * found = ( const uint8_t * ) memchr ( cells + index , 0 , end - index ) ;
+		return ( found != NULL ) ? ( found - cells ) : -1 ;
+	}
+# if SCAN_VECTOR
+	if ( stride <= SCAN_BLOCK_STRIDE_MAXIMUM ) {																	//Check if the stride is small enough for a block to hold several candidate cells.
+		return scan_avx2 ? scan_forward_avx2 ( cells , index , end , stride ) : scan_forward_sse2 ( cells , index , end , stride ) ;
+	}
+# endif
+	for ( ; index < end ; index += stride ) {																		//Check the remaining cells one at a time.
+		if ( cells [ index ] == 0 ) {
+			return index ;
+		}
+	}
+	return -1 ;
+}
+
+long long scan_backward ( const uint8_t * cells , long long index , long long stride ) {
+	long long checked ;
+	for ( checked = 0 ; ( checked < SCAN_SCALAR_CELLS ) && ( index >= 0 ) ; checked ++ , index -= stride ) {		//Check the first few cells one at a time, since most scans stop quickly.
+		if ( cells [ index ] == 0 ) {
+			return index ;
+		}
+	}
+	if ( index < 0 ) {																								//Check if there are no cells left to scan.
+		return -1 ;
+	}
+# if SCAN_VECTOR
+	if ( stride <= SCAN_BLOCK_STRIDE_MAXIMUM ) {																	//Check if the stride is small enough for a block to hold several candidate cells.
+		return scan_avx2 ? scan_backward_avx2 ( cells , index , stride ) : scan_backward_sse2 ( cells , index , stride ) ;
+	}
+# endif
+	for ( ; index >= 0 ; index -= stride ) {																		//Check the remaining cells one at a time.
+		if ( cells [ index ] == 0 ) {
+			return index ;
+		}
+	}
+	return -1 ;
+}
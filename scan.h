@@ -0,0 +1,26 @@
+# ifndef BRAINF_SCAN_FILE
+	# define BRAINF_SCAN_FILE 0
+
+	# include <stdint.h>
+
+	# define SCAN_BLOCK_STRIDE_MAXIMUM 16										//The largest stride scanned a block of cells at a time.
+
+	/**
+	 * The initializer function that detects the vector instructions supported by the processor and picks the scan kernels to use.
+	 * Called once by the library, before any scan.
+	 */
+	void scan_init ( ) ;
+
+	/**
+	 * The forward scan function that finds the first cell holding 0 at the start, or after it at a multiple of the stride, before the end.
+	 * Returns the index of the cell found, or -1 if there is none.
+	 */
+	long long scan_forward ( const uint8_t * , long long , long long , long long ) ;
+
+	/**
+	 * The backward scan function that finds the first cell holding 0 at the start, or before it at a multiple of the stride, down to the first cell.
+	 * Returns the index of the cell found, or -1 if there is none.
+	 */
+	long long scan_backward ( const uint8_t * , long long , long long ) ;
+
+#endif
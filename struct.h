@@ -1,31 +1,70 @@
 # ifndef BRAINF_STRUCT_FILE
 	# define BRAINF_STRUCT_FILE 0
 
+	# include <setjmp.h>
 	# include <stdio.h>
 	
+	# define PROGRAM_LIST_INITIAL_SIZE 4096										//The number of cells the program list starts with.
+	# define OPTIMIZATION_LEVEL_DEFAULT 3										//The level of optimizations applied when no level is given.
+	# define OPTIMIZATION_LEVEL_MAXIMUM 3										//The highest level of optimizations available.
+	# define PROGRAM_IO_BUFFER_SIZE 65536										//The number of bytes the program input and output buffers hold.
+	# define PROFILE_HISTOGRAM_SIZE 16											//The number of buckets in a loop iteration histogram.
+	# define PROFILE_REPORT_LOOPS 10											//The number of hottest loops shown in the profile report.
+	# define PREFIX_BUDGET_DEFAULT 1000000										//The most instructions run when the program is compiled, when no budget is given.
+	# define PREFIX_LIST_MAXIMUM 1048576										//The most cells the program list may grow to while the prefix is run.
+	# define PREFIX_OUTPUT_MAXIMUM 1048576										//The most bytes of output the prefix may write.
+	
 	/**
-	 * A node of the main list which is manipulated by the program.
+	 * The list that is being manipulated by the program, stored as a single contiguous array of cells.
 	 */
-	struct program_list_node {
-		uint8_t value ;															//The value of the node in the list.
-		struct program_list_node * previous_node ;								//The pointer to the previous node in the list, if any.
-		struct program_list_node * next_node ;									//The pointer to the next node in the list, if any.
+	struct program_list {
+		uint8_t * cells ;														//The array of cells in the list, each as many bytes as the width.
+		int width ;																//The number of bytes in every cell.
+		long long size ;														//The number of cells in the array.
+		long long position ;													//The index of the current cell in the array.
+		long long origin ;														//The index of the cell the pointer started at.
 	} ;
 	
 	/**
-	 * A node of the loop list of the program.
+	 * The operations an instruction of the program can perform.
 	 */
-	struct loop_stack_node {
-		long long start_pointer_position ;										//The input pointer position for the start of the loop.
-		struct loop_stack_node * outer_loop_node ;								//The pointer to the outer loop of the loop, if any.
+	enum program_operation {
+		OPERATION_ADD ,															//Add the argument to the cell.
+		OPERATION_MOVE ,														//Move the program list pointer by the argument.
+		OPERATION_OUTPUT ,														//Output the cell.
+		OPERATION_INPUT ,														//Input the cell.
+		OPERATION_LOOP_START ,													//Skip to the end of the loop if the current cell is 0.
+		OPERATION_LOOP_END ,													//Go back to the start of the loop if the current cell is not 0.
+		OPERATION_SET ,															//Set the cell to the argument.
+		OPERATION_MULTIPLY ,													//Add the cell multiplied by the argument to the cell at the distance from it.
+		OPERATION_SCAN ,														//Move the program list pointer by the argument until it reaches a cell holding 0.
+		OPERATION_GUARD															//Grow the program list if any cell from the low to the high offset from the pointer is outside it.
 	} ;
 	
 	/**
-	 * The lists that are being manipulated by the program as well as the loops currently being run within the program.
+	 * A single instruction of the program, loaded from the program file.
 	 */
-	struct program_list {
-		struct program_list_node * list_position ;								//The pointer to the current position in the program list.
-		struct loop_stack_node * loop_top ;										//The pointer to the current position in the loop.
+	struct program_instruction {
+		enum program_operation operation ;										//The operation performed by the instruction.
+		long long argument ;													//The count, value or factor used by the operation.
+		long long offset ;														//The offset from the program list pointer of the cell the operation is performed on.
+		long long distance ;													//The distance from the cell to the cell a multiplication adds to.
+		long long jump ;														//The index of the matching loop instruction, if the instruction is a loop.
+		long long position ;													//The byte position of the instruction in the program file.
+		long long low ;															//The lowest offset from the pointer reached before the next check, if the instruction is a guard.
+		long long high ;														//The highest offset from the pointer reached before the next check, if the instruction is a guard.
+	} ;
+	
+	/**
+	 * The instructions of the program loaded from the program file.
+	 */
+	struct program_code {
+		struct program_instruction * instructions ;								//The array of instructions loaded from the program file.
+		long long length ;														//The number of instructions in the array.
+		long long counter ;														//The index of the instruction currently being executed.
+		long long executed ;													//The number of instructions executed by the profiled engine.
+		long long checks ;														//The number of bounds checks the instructions would make on their own.
+		long long guards ;														//The number of bounds checks kept after the bounds analysis.
 	} ;
 	
 	/**
@@ -42,18 +81,206 @@
 	struct input_file {
 		FILE * source ;															//The program file being interpreted.
 		struct input_pointer pointer ;											//The current input position details.
-		uint8_t status ;														//The status of the program being interpreted.
+		int status ;															//The status of the program being interpreted.
 		char message [ 65536 ] ;												//A message about the current status of the program being interpreted.
 	} ;
 	
+	/**
+	 * The engines that can execute the program instructions.
+	 */
+	enum program_engine {
+		ENGINE_INTERPRETER ,													//Interpret the instructions one at a time.
+		ENGINE_JIT																//Compile the instructions to machine code and run it.
+	} ;
+	
+	/**
+	 * The policies for when the program output buffer is written out.
+	 */
+	enum program_flush {
+		FLUSH_AUTO ,															//Write out at every newline if the output is a terminal, or only when full otherwise.
+		FLUSH_LINE ,															//Write out at every newline, and before waiting for input.
+		FLUSH_FULL																//Write out only when the buffer is full and when the program ends.
+	} ;
+	
+	/**
+	 * The widths of the program list cells, each twice the last, so that a cell holds 1 << width bytes.
+	 */
+	enum program_cell {
+		CELL_8 ,																//Cells of 8 bits. ( default )
+		CELL_16 ,																//Cells of 16 bits.
+		CELL_32																	//Cells of 32 bits.
+	} ;
+	
+	/**
+	 * The policies for what an input does to the cell once the program input has ended.
+	 */
+	enum program_eof {
+		EOF_UNCHANGED ,															//Leave the cell as it is.
+		EOF_ZERO ,																//Set the cell to 0.
+		EOF_MINUS_ONE															//Set the cell to -1, wrapped around to the highest value of the cell. ( default )
+	} ;
+	
+	/**
+	 * The options the interpreter was started with.
+	 */
+	struct program_options {
+		int optimization_level ;												//The level of optimizations applied to the program instructions.
+		enum program_engine engine ;											//The engine executing the program instructions.
+		enum program_flush flush ;												//The policy for writing out the program output buffer.
+		int profile ;															//Whether the execution of the program is profiled.
+		char * profile_dump ;													//The file the profile is dumped to, or NULL for no dump.
+		long long prefix_budget ;												//The most instructions run when the program is compiled, or 0 to run none.
+		enum program_cell cell ;												//The width of the program list cells.
+		enum program_eof eof ;													//The policy for inputs once the program input has ended.
+	} ;
+	
+	/**
+	 * The start of the program that does not depend on the input, run when the program is compiled.
+	 */
+	struct program_prefix {
+		uint8_t * cells ;														//The cells the prefix left on the program list, from the lowest to the highest that is not 0, each as many bytes as the width of the list.
+		long long length ;														//The number of cells.
+		long long position ;													//The index of the cell the pointer was left at.
+		long long origin ;														//The index of the cell the pointer started at.
+		uint8_t * output ;														//The output written by the prefix.
+		long long output_length ;												//The number of bytes of output.
+		long long executed ;													//The number of instructions the prefix ran.
+		long long removed ;														//The number of instructions taken from the start of the program by the prefix.
+	} ;
+	
+	/**
+	 * The state of the prefix while it is run.
+	 */
+	struct prefix_state {
+		struct program_list list ;												//The program list the prefix works on.
+		uint8_t * output ;														//The output written so far.
+		long long output_length ;												//The number of bytes of output written so far.
+		long long output_capacity ;												//The number of bytes the output can hold before it is grown.
+		long long counter ;														//The index of the instruction the prefix stopped at.
+		long long executed ;													//The number of instructions run.
+		int failed ;															//Whether the prefix stopped partway through an instruction, as the list or output grew past their limits.
+	} ;
+	
+	/**
+	 * The details of the program, declared ahead for the JIT table which refers back to them.
+	 */
+	struct program_details ;
+	
+	/**
+	 * The table through which machine code compiled by the JIT engine reaches the program list and the program input and output.
+	 */
+	struct jit_table {
+		uint8_t * low ;															//The lowest cell the pointer may be at without growing the list, as the address of its first byte.
+		uint8_t * high ;														//The cell after the highest cell the pointer may be at without growing the list.
+		uint8_t * ( * grow ) ( struct jit_table * , uint8_t * ) ;				//The function that grows the list around the pointer and returns the moved pointer.
+		uint8_t * ( * scan ) ( struct jit_table * , uint8_t * , long long ) ;	//The function that scans the list and returns the moved pointer.
+		void ( * output ) ( struct jit_table * , int ) ;						//The function that outputs a value.
+		int ( * input ) ( struct jit_table * , int ) ;							//The function that inputs a value, given the value of the cell, and returns the value to store in it.
+		long long margin ;														//The number of cells that must exist on either side of the pointer.
+		struct program_details * details ;										//The details of the program the machine code is run for.
+	} ;
+	
+	/**
+	 * The machine code compiled by the JIT engine.
+	 */
+	struct jit_program {
+		uint8_t * code ;														//The executable buffer holding the machine code.
+		long long capacity ;													//The size of the buffer.
+		long long size ;														//The size of the machine code in the buffer.
+		long long margin ;														//The largest distance from the pointer of any cell the machine code accesses.
+		enum program_cell cell ;												//The width of the cells the machine code works on.
+		int width ;																//The number of bytes in every cell the machine code works on.
+		double compile_time ;													//The CPU time taken to compile the machine code.
+	} ;
+	
+	/**
+	 * The buffered program input and output.
+	 */
+	struct program_io {
+		long long ( * read ) ( void * , uint8_t * , long long ) ;				//The function that reads input into a buffer, or NULL if the whole input is in memory.
+		long long ( * write ) ( void * , const uint8_t * , long long ) ;		//The function that writes output from a buffer, or NULL if the output stays in memory.
+		void * user ;															//The value the read and write functions are given.
+		uint8_t * output ;														//The buffer holding the output not yet written out.
+		long long output_length ;												//The number of bytes in the output buffer.
+		long long output_capacity ;												//The number of bytes the output buffer can hold.
+		uint8_t * output_buffer ;												//The buffer output is gathered in before it is written, if the output is written out.
+		uint8_t overflow ;														//The byte written to once the caller's output buffer is full, to catch more output.
+		int fixed ;																//Whether the output is kept in the caller's buffer instead of being written out.
+		int failed ;															//Whether any output could not be written or did not fit.
+		int line ;																//Whether the output buffer is written out at every newline.
+		const uint8_t * input ;													//The input not yet consumed, either given in memory or read into the input buffer.
+		long long input_length ;												//The number of bytes of input available.
+		long long input_position ;												//The index of the next byte of input.
+		uint8_t * input_buffer ;												//The buffer input is read into, if the input is not in memory.
+		int mapped ;															//Whether the whole input is in memory, such as a mapped input file.
+		int input_failed ;														//Whether the input could not be read, rather than having ended.
+		long long output_bytes ;												//The number of bytes output.
+		long long output_writes ;												//The number of times the output buffer was written out.
+		long long input_bytes ;													//The number of bytes input.
+		long long input_reads ;													//The number of times the input buffer was refilled.
+	} ;
+	
+	/**
+	 * The execution counts of a loop of the program, gathered by the profiler.
+	 */
+	struct profile_loop {
+		long long start ;														//The index of the instruction starting the loop.
+		long long entries ;														//The number of times the start of the loop was reached.
+		long long iterations ;													//The number of times the body of the loop was run.
+		long long current ;														//The number of times the body has been run since the loop was last entered.
+		long long cost ;														//The number of instructions executed within the loop, including nested loops.
+		long long histogram [ PROFILE_HISTOGRAM_SIZE ] ;						//The number of entries by iterations, 0 in the first bucket and up to twice the last in each next one.
+	} ;
+	
+	/**
+	 * The execution counts of the program, gathered by the profiler.
+	 */
+	struct program_profile {
+		long long * counts ;													//The number of times each instruction was executed.
+		long long * loop_index ;												//The index of the loop each loop instruction belongs to.
+		struct profile_loop * loops ;											//The loops of the program, in the order they start.
+		long long loop_count ;													//The number of loops.
+		long long low ;															//The lowest cell reached, counted from the cell the pointer started at.
+		long long high ;														//The highest cell reached, counted from the cell the pointer started at.
+	} ;
+	
 	/**
 	 * The details of the program being interpreted.
 	 */
 	struct program_details {
 		struct input_file file ;												//The program file.
 		struct program_list list ;												//The program list
+		struct program_code code ;												//The program instructions.
+		struct program_options options ;										//The interpreter options.
+		struct jit_program jit ;												//The machine code, if the JIT engine is used.
 		FILE * progin ;															//The program input file.
 		FILE * progout ;														//The program output file.
+		struct program_io io ;													//The buffered program input and output.
+		struct program_profile profile ;										//The execution counts, if the program is profiled.
+		struct program_prefix prefix ;											//The state left by the start of the program, run when it was compiled.
+	} ;
+	
+	/**
+	 * The context of the library a program is compiled and run in.
+	 */
+	struct bf_context {
+		struct program_details details ;										//The options, the program list and the error of the context, which come first so the context can be found from them.
+		jmp_buf error ;															//The place the running program returns to when it hits an error.
+		int jit ;																//Whether the last run ran as machine code.
+		int profiled ;															//Whether the last run was profiled.
+	} ;
+	
+	/**
+	 * A program compiled by the library, which is never changed once compiled.
+	 */
+	struct bf_program {
+		struct program_code code ;												//The optimized program instructions.
+		struct jit_program jit ;												//The machine code, if the program was compiled by the JIT engine.
+		struct program_prefix prefix ;											//The state every run starts from, left by the start of the program.
+		enum program_cell cell ;												//The width of the program list cells the program was compiled for.
+		enum program_eof eof ;													//The policy for inputs once the program input has ended.
+		char * source ;															//The program source, kept to show the loops of the profile report.
+		long long source_length ;												//The number of bytes of program source.
 	} ;
 
 #endif